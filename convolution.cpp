@@ -0,0 +1,442 @@
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <random>
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <type_traits>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <concepts>
+
+constexpr int MOD1 = 1000000007;
+constexpr int MOD2 = 998244353;
+
+template <int mod>
+struct MontgomeryModInt {  // odd compile-time modulus < 2^30, same interface as ModInt
+	static_assert(mod & 1 && mod < (1 << 30));
+
+private:
+	using u32 = unsigned int;
+	using u64 = unsigned long long;
+
+	static constexpr u32 get_r() {  // -mod^{-1} mod 2^32
+		u32 inv = mod;
+		for (int i = 0; i < 4; i++) inv *= 2 - mod * inv;
+		return -inv;
+	}
+	static constexpr u32 neg_inv = get_r();
+	static constexpr u32 n2 = -u64(mod) % mod;  // 2^64 mod mod
+
+	static constexpr u32 reduce(u64 b) {  // b * 2^-32 mod mod, result in [0, 2 * mod)
+		return (b + u64(u32(b) * neg_inv) * mod) >> 32;
+	}
+
+	u32 x;  // x * 2^32 mod mod, kept in [0, mod)
+
+public:
+	MontgomeryModInt() : x(0) {}
+	MontgomeryModInt(long long x_) : x(reduce(u64(x_ % mod + mod) * n2)) { if (x >= mod) x -= mod; }
+
+	constexpr MontgomeryModInt& operator+=(MontgomeryModInt rhs) { if ((x += rhs.x) >= mod) x -= mod; return *this; }
+	constexpr MontgomeryModInt& operator-=(MontgomeryModInt rhs) { if ((x += mod - rhs.x) >= mod) x -= mod; return *this; }
+	constexpr MontgomeryModInt& operator*=(MontgomeryModInt rhs) { if ((x = reduce(u64(x) * rhs.x)) >= mod) x -= mod; return *this; }
+	constexpr MontgomeryModInt& operator/=(MontgomeryModInt rhs) { return *this *= rhs.inv(); }
+
+	constexpr MontgomeryModInt operator-() const noexcept { return MontgomeryModInt() - *this; }
+	constexpr MontgomeryModInt operator+(MontgomeryModInt rhs) const noexcept { return MontgomeryModInt(*this) += rhs; }
+	constexpr MontgomeryModInt operator-(MontgomeryModInt rhs) const noexcept { return MontgomeryModInt(*this) -= rhs; }
+	constexpr MontgomeryModInt operator*(MontgomeryModInt rhs) const noexcept { return MontgomeryModInt(*this) *= rhs; }
+	constexpr MontgomeryModInt operator/(MontgomeryModInt rhs) const noexcept { return MontgomeryModInt(*this) /= rhs; }
+
+	constexpr MontgomeryModInt& operator++() { *this += 1; return *this; }
+	constexpr MontgomeryModInt operator++(int) { *this += 1; return *this - 1; }
+	constexpr MontgomeryModInt& operator--() { *this -= 1; return *this; }
+	constexpr MontgomeryModInt operator--(int) { *this -= 1; return *this + 1; }
+
+	bool operator==(MontgomeryModInt rhs) const { return x == rhs.x; }
+	bool operator!=(MontgomeryModInt rhs) const { return x != rhs.x; }
+	bool operator<=(MontgomeryModInt rhs) const { return value() <= rhs.value(); }
+	bool operator>=(MontgomeryModInt rhs) const { return value() >= rhs.value(); }
+	bool operator<(MontgomeryModInt rhs) const { return value() < rhs.value(); }
+	bool operator>(MontgomeryModInt rhs) const { return value() > rhs.value(); }
+
+	friend std::istream& operator>>(std::istream& s, MontgomeryModInt& a) { long long v; s >> v; a = v; return s; }
+	friend std::ostream& operator<<(std::ostream& s, MontgomeryModInt a) { s << a.value(); return s; }
+
+	int value() const {
+		u32 v = reduce(x);
+		return v >= mod ? v - mod : v;
+	}
+
+	MontgomeryModInt inv() const {
+		int a = value(), b = mod, u = 1, v = 0, t;
+		while (b > 0) { t = a / b, std::swap(a -= t * b, b), std::swap(u -= t * v, v); }
+		return MontgomeryModInt(u);
+	}
+
+	MontgomeryModInt pow(long long n) const {
+		MontgomeryModInt ret(1), mul(*this);
+		while (n > 0) { if (n & 1) ret *= mul; mul *= mul; n >>= 1; }
+		return ret;
+	}
+
+	int sqrt() const {
+		if (value() <= 1) return value();
+		if (pow((mod - 1) / 2) != 1) return -1;
+
+		int q = mod - 1, m = 0;
+		std::mt19937 mt;
+		MontgomeryModInt z = mt();
+
+		while (~q & 1) q >>= 1, m++;
+		while (z.pow((mod - 1) / 2) != mod - 1) z = mt();
+
+		MontgomeryModInt c = z.pow(q);
+		MontgomeryModInt t = pow(q);
+		MontgomeryModInt r = pow((q + 1) / 2);
+
+		for (; m > 1; m--) {
+			MontgomeryModInt tmp = t.pow(1 << (m - 2));
+			if (tmp != 1) r = r * c, t = t * c * c;
+			c = c * c;
+		}
+
+		return std::min(r.value(), mod - r.value());
+	}
+};
+
+constexpr int primitive_root(int m) {
+    if (m == 2) return 1;
+    int divs[20] = {2}, cnt = 1;
+    int x = (m - 1) / 2;
+    while (x % 2 == 0) x /= 2;
+    for (int i = 3; (long long)i * i <= x; i += 2) {
+        if (x % i == 0) {
+            divs[cnt++] = i;
+            while (x % i == 0) x /= i;
+        }
+    }
+    if (x > 1) divs[cnt++] = x;
+    for (int g = 2;; g++) {
+        bool ok = true;
+        for (int i = 0; i < cnt && ok; i++) {
+            long long r = 1, b = g, e = (m - 1) / divs[i];
+            for (; e; e >>= 1, b = b * b % m) if (e & 1) r = r * b % m;
+            ok = r != 1;
+        }
+        if (ok) return g;
+    }
+}
+
+template <int mod>
+struct NTT {
+    using mint = MontgomeryModInt<mod>;
+    static constexpr int g = primitive_root(mod);
+    static constexpr int rank2 = std::countr_zero((unsigned int)(mod - 1));  // max transform size is 2^rank2
+
+private:
+    // w[len + j] = (2len-th root)^j for every power of two len, shared by all sizes up to w.size()
+    static inline std::vector<mint> w{0, 1}, iw{0, 1};
+
+    static void prepare(int n) {
+        for (int len = w.size(); len < n; len <<= 1) {
+            mint r = mint(g).pow((mod - 1) / (len << 1)), ir = r.inv();
+            w.resize(len << 1), iw.resize(len << 1);
+            w[len] = iw[len] = 1;
+            for (int j = 1; j < len; j++) w[len + j] = w[len + j - 1] * r, iw[len + j] = iw[len + j - 1] * ir;
+        }
+    }
+
+public:
+    // natural order in, bit-reversed order out (Gentleman-Sande), so no permutation pass is needed;
+    // two levels are fused per pass while at least two remain
+    static void transform(std::vector<mint>& a) {
+        const int n = a.size();
+        prepare(n);
+        int len = n >> 1;
+        for (; len >= 2; len >>= 2) {
+            const int q = len >> 1;
+            const mint* t1 = w.data() + len;
+            const mint* t2 = w.data() + q;
+            for (int i = 0; i < n; i += len << 1) {
+                mint* p = a.data() + i;
+                for (int j = 0; j < q; j++) {
+                    mint a0 = p[j], a1 = p[j + q], a2 = p[j + 2 * q], a3 = p[j + 3 * q];
+                    mint b0 = a0 + a2, b1 = a1 + a3;
+                    mint b2 = (a0 - a2) * t1[j], b3 = (a1 - a3) * t1[j + q];
+                    p[j] = b0 + b1;
+                    p[j + q] = (b0 - b1) * t2[j];
+                    p[j + 2 * q] = b2 + b3;
+                    p[j + 3 * q] = (b2 - b3) * t2[j];
+                }
+            }
+        }
+        if (len == 1) {
+            for (int i = 0; i < n; i += 2) {
+                mint u = a[i], v = a[i + 1];
+                a[i] = u + v;
+                a[i + 1] = u - v;
+            }
+        }
+    }
+
+    // bit-reversed order in, natural order out (Cooley-Tukey), scaled by 1/n
+    static void inverse_transform(std::vector<mint>& a) {
+        const int n = a.size();
+        prepare(n);
+        int len = 1;
+        if (std::countr_zero((unsigned int)n) & 1) {
+            for (int i = 0; i < n; i += 2) {
+                mint u = a[i], v = a[i + 1];
+                a[i] = u + v;
+                a[i + 1] = u - v;
+            }
+            len = 2;
+        }
+        for (; len < n; len <<= 2) {
+            const int q = len;
+            const mint* t1 = iw.data() + q;
+            const mint* t2 = iw.data() + (q << 1);
+            for (int i = 0; i < n; i += len << 2) {
+                mint* p = a.data() + i;
+                for (int j = 0; j < q; j++) {
+                    mint a0 = p[j], a1 = p[j + q] * t1[j], a2 = p[j + 2 * q], a3 = p[j + 3 * q] * t1[j];
+                    mint b0 = a0 + a1, b1 = a0 - a1, b2 = (a2 + a3) * t2[j], b3 = (a2 - a3) * t2[j + q];
+                    p[j] = b0 + b2;
+                    p[j + 2 * q] = b0 - b2;
+                    p[j + q] = b1 + b3;
+                    p[j + 3 * q] = b1 - b3;
+                }
+            }
+        }
+        const mint inv_n = mint(n).inv();
+        for (mint& x : a) x *= inv_n;
+    }
+};
+
+template <int mod>
+std::vector<MontgomeryModInt<mod>> convolution(std::vector<MontgomeryModInt<mod>> a, std::vector<MontgomeryModInt<mod>> b) {
+    using mint = MontgomeryModInt<mod>;
+    const int n = a.size(), m = b.size();
+    if (!n || !m) return {};
+    if (std::min(n, m) <= 60) {
+        std::vector<mint> c(n + m - 1);
+        for (int i = 0; i < n; i++) for (int j = 0; j < m; j++) c[i + j] += a[i] * b[j];
+        return c;
+    }
+    const int sz = std::bit_ceil((unsigned int)(n + m - 1));
+    assert(std::countr_zero((unsigned int)sz) <= NTT<mod>::rank2);
+    a.resize(sz), b.resize(sz);
+    NTT<mod>::transform(a);
+    NTT<mod>::transform(b);
+    for (int i = 0; i < sz; i++) a[i] *= b[i];
+    NTT<mod>::inverse_transform(a);
+    a.resize(n + m - 1);
+    return a;
+}
+
+// any modint T (constructible from long long, with value()); exact while min(n, m) * (mod - 1)^2 < m1 * m2 * m3 ~ 5.95e25
+template <typename T>
+std::vector<T> convolution_any_mod(const std::vector<T>& a, const std::vector<T>& b) {
+    constexpr int m1 = 754974721, m2 = 167772161, m3 = 469762049;  // 2^24 | m - 1 for all three
+    using mint2 = MontgomeryModInt<m2>;
+    using mint3 = MontgomeryModInt<m3>;
+    if (a.empty() || b.empty()) return {};
+    using u128 = unsigned __int128;
+    const u128 r = (T(0) - T(1)).value();  // mod - 1
+    assert(std::min(a.size(), b.size()) <= (u128(m1) * m2 * m3 - 1) / std::max<u128>(r * r, 1));
+
+    auto run = [&]<int mod>(std::integral_constant<int, mod>) {
+        std::vector<MontgomeryModInt<mod>> x(a.size()), y(b.size());
+        for (size_t i = 0; i < a.size(); i++) x[i] = T(a[i]).value();
+        for (size_t i = 0; i < b.size(); i++) y[i] = T(b[i]).value();
+        return convolution<mod>(std::move(x), std::move(y));
+    };
+    const auto c1 = run(std::integral_constant<int, m1>{});
+    const auto c2 = run(std::integral_constant<int, m2>{});
+    const auto c3 = run(std::integral_constant<int, m3>{});
+
+    // Garner: x = k1 + m1 * k2 + m1 * m2 * k3
+    const mint2 inv_m1_mod_m2 = mint2(m1).inv();
+    const mint3 inv_m1m2_mod_m3 = (mint3(m1) * mint3(m2)).inv();
+    const T m1_t = m1, m1m2_t = T(m1) * T(m2);
+
+    std::vector<T> c(c1.size());
+    for (size_t i = 0; i < c.size(); i++) {
+        const long long k1 = c1[i].value();
+        const long long k2 = ((c2[i] - mint2(k1)) * inv_m1_mod_m2).value();
+        const long long k3 = ((c3[i] - mint3(k1) - mint3(m1) * mint3(k2)) * inv_m1m2_mod_m3).value();
+        c[i] = T(k1) + m1_t * T(k2) + m1m2_t * T(k3);
+    }
+    return c;
+}
+/*
+    // example
+    using mint = MontgomeryModInt<MOD2>;
+    std::vector<mint> c = convolution(a, b);
+
+    static int MOD = MOD1;
+    std::vector<ModInt<MOD>> c = convolution_any_mod(a, b);
+*/
+
+
+struct FastInput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0, len = 0;
+
+    inline void refill() {
+        len -= pos;
+        std::memmove(buf, buf + pos, len);
+        pos = 0;
+        len += std::fread(buf + len, 1, BUF_SIZE - len, stdin);
+        if (len < BUF_SIZE) buf[len] = '\0';
+    }
+
+    inline char peek() {
+        if (pos == len) refill();
+        return pos < len ? buf[pos] : '\0';
+    }
+
+    inline char skip() {  // skips whitespace, returns the first non-space char ('\0' on EOF)
+        char c;
+        while ((c = peek()) && c <= ' ') pos++;
+        return c;
+    }
+
+public:
+    template <std::integral T>
+    void read(T& x) {
+        skip();
+        if (len - pos < 64) refill();
+        bool neg = false;
+        if constexpr (std::is_signed_v<T>) {
+            if (buf[pos] == '-') neg = true, pos++;
+        }
+        std::make_unsigned_t<T> v = 0;
+        while (pos < len && (unsigned)(buf[pos] - '0') < 10) v = v * 10 + (buf[pos++] - '0');
+        x = neg ? -(T)v : (T)v;
+    }
+
+    void read(char& c) { if ((c = skip())) pos++; }
+
+    void read(std::string& s) {
+        s.clear();
+        for (char c = skip(); c > ' '; c = peek()) s.push_back(c), pos++;
+    }
+
+    void read(double& x) {
+        std::string s;
+        read(s);
+        x = std::stod(s);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); } && std::constructible_from<T, long long>
+    void read(T& x) {  // ModInt
+        long long v;
+        read(v);
+        x = T(v);
+    }
+
+    template <typename T, typename U>
+    void read(std::pair<T, U>& p) { read(p.first), read(p.second); }
+
+    template <typename T>
+    void read(std::vector<T>& v) { for (auto& x : v) read(x); }
+
+    template <typename T>
+    FastInput& operator>>(T& x) { read(x); return *this; }
+};
+
+struct FastOutput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0;
+
+    inline void reserve(int k) {
+        if (pos + k > BUF_SIZE) flush();
+    }
+
+public:
+    ~FastOutput() { flush(); }
+
+    void flush() {
+        std::fwrite(buf, 1, pos, stdout);
+        std::fflush(stdout);
+        pos = 0;
+    }
+
+    template <std::integral T>
+    void write(T x) {
+        reserve(40);
+        std::make_unsigned_t<T> v = x;
+        if constexpr (std::is_signed_v<T>) {
+            if (x < 0) buf[pos++] = '-', v = -v;
+        }
+        char tmp[40];
+        int k = 0;
+        do tmp[k++] = '0' + v % 10; while (v /= 10);
+        while (k) buf[pos++] = tmp[--k];
+    }
+
+    void write(char c) { reserve(1); buf[pos++] = c; }
+
+    void write(const char* s) { write(std::string_view(s)); }
+
+    void write(std::string_view s) {
+        for (size_t i = 0; i < s.size();) {
+            if (pos == BUF_SIZE) flush();
+            size_t k = std::min(s.size() - i, (size_t)(BUF_SIZE - pos));
+            std::memcpy(buf + pos, s.data() + i, k);
+            pos += k, i += k;
+        }
+    }
+
+    void write(double x) {
+        reserve(64);
+        pos += std::snprintf(buf + pos, 64, "%.15f", x);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); }
+    void write(T x) { write(x.value()); }  // ModInt
+
+    template <typename T, typename U>
+    void write(const std::pair<T, U>& p) { write(p.first), write(' '), write(p.second); }
+
+    template <typename T>
+    void write(const std::vector<T>& v) {
+        for (size_t i = 0; i < v.size(); i++) {
+            if (i) write(' ');
+            write(v[i]);
+        }
+    }
+
+    template <typename T>
+    FastOutput& operator<<(const T& x) { write(x); return *this; }
+};
+
+static FastInput in;
+static FastOutput out;
+
+
+// https://judge.yosupo.jp/problem/convolution_mod
+int main() {
+    int N, M;
+    in >> N >> M;
+
+    using mint = MontgomeryModInt<MOD2>;
+    std::vector<mint> a(N), b(M);
+    in >> a >> b;
+
+    out << convolution(a, b) << '\n';
+
+    return 0;
+}
@@ -0,0 +1,437 @@
+#include <concepts>
+#include <vector>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <type_traits>
+
+template <typename F, typename S>
+concept BinaryOperation = requires(F f, S a, S b) {
+    { f(a, b) } -> std::convertible_to<S>;
+};
+
+template <typename G, typename S, typename E>
+concept MappingFunction = requires(G g, S data, E update) {
+    { g(data, update) } -> std::convertible_to<S>;
+};
+
+template <typename H, typename E>
+concept CompositionFunction = requires(H h, E existing, E update) {
+    { h(existing, update) } -> std::convertible_to<E>;
+};
+
+// Segment tree over [0, n) for n up to 2^62, nodes allocated on first write from one arena with
+// 32-bit child indices (0 = untouched). Every leaf starts as init (e by default); an untouched
+// subtree of height d is worth pw[d] = init folded 2^d times, so nothing is materialized for it.
+// Memory: a point update allocates at most ceil(log2 n) + 1 nodes.
+template <typename S, typename F>
+requires BinaryOperation<F, S>
+class DynamicSegmentTree {
+private:
+    struct Node {
+        S val;
+        unsigned ch[2];
+    };
+
+    long long n;
+    int log;
+    unsigned root = 0;
+    std::vector<Node> nodes;  // nodes[0] is a placeholder
+    std::vector<S> pw;        // pw[d]: value of an untouched subtree of height d
+    F f;
+    S e;
+
+    S value(unsigned k, int d) const { return k ? nodes[k].val : pw[d]; }
+
+    S repeat(long long c) const {  // c untouched leaves folded
+        S r = e;
+        for (int d = 0; c; d++, c >>= 1) {
+            if (c & 1) r = f(r, pw[d]);
+        }
+        return r;
+    }
+
+    unsigned new_node(int d) {
+        nodes.push_back({pw[d], {0, 0}});
+        return nodes.size() - 1;
+    }
+
+    S query(unsigned k, int d, long long lo, long long a, long long b) const {  // k covers [lo, lo + 2^d)
+        long long hi = lo + (1LL << d);
+        a = std::max(a, lo), b = std::min(b, hi);
+        if (a >= b) return e;
+        if (a == lo && b == hi) return value(k, d);
+        if (!k) return repeat(b - a);
+        long long mid = lo + (1LL << (d - 1));
+        return f(query(nodes[k].ch[0], d - 1, lo, a, b), query(nodes[k].ch[1], d - 1, mid, a, b));
+    }
+
+public:
+    DynamicSegmentTree(long long n_, F f_, S e_) : DynamicSegmentTree(n_, f_, e_, e_) {}
+
+    DynamicSegmentTree(long long n_, F f_, S e_, S init) : n(n_), log(0), f(f_), e(e_) {
+        while ((1LL << log) < n) log++;
+        pw.push_back(init);
+        for (int d = 1; d <= log; d++) pw.push_back(f(pw[d - 1], pw[d - 1]));
+        nodes.push_back({e, {0, 0}});
+    }
+
+    void reserve(int updates) { nodes.reserve(nodes.size() + (size_t)updates * (log + 1)); }
+
+    int node_count() const { return nodes.size() - 1; }
+
+    void update(long long i, const S& x) {
+        unsigned path[64];
+        if (!root) root = new_node(log);
+        path[0] = root;
+        for (int j = 0; j < log; j++) {
+            int b = i >> (log - 1 - j) & 1;
+            unsigned c = nodes[path[j]].ch[b];
+            if (!c) {
+                c = new_node(log - 1 - j);
+                nodes[path[j]].ch[b] = c;
+            }
+            path[j + 1] = c;
+        }
+        nodes[path[log]].val = x;
+        for (int j = log - 1; j >= 0; j--) {
+            Node& p = nodes[path[j]];
+            p.val = f(value(p.ch[0], log - 1 - j), value(p.ch[1], log - 1 - j));
+        }
+    }
+
+    S operator[](long long i) const {
+        unsigned k = root;
+        for (int d = log; d > 0 && k; d--) k = nodes[k].ch[i >> (d - 1) & 1];
+        return value(k, 0);
+    }
+
+    S query(long long a, long long b) const {  // [a, b)
+        if (a >= b) return e;
+        return query(root, log, 0, a, b);
+    }
+
+    S all_prod() const { return query(0, n); }
+};
+
+// DynamicSegmentTree with range updates, same F / G / H contract as LazySegmentTree. Queries are
+// const: instead of pushing, the tags on the way down are applied to the partial folds on the way
+// back (valid because g(., x) distributes over f). An update pushes and so materializes both
+// children of every partially covered node: at most 4 * ceil(log2 n) + 1 new nodes per update.
+template <typename S, typename E, typename F, typename G, typename H>
+requires BinaryOperation<F, S> &&
+        MappingFunction<G, S, E> &&
+        CompositionFunction<H, E>
+class DynamicLazySegmentTree {
+private:
+    struct Node {
+        S val;
+        E lz;
+        unsigned ch[2];
+    };
+
+    long long n;
+    int log;
+    unsigned root = 0;
+    std::vector<Node> nodes;
+    std::vector<S> pw;
+    F f;
+    G g;
+    H h;
+    S e;
+    E id;
+
+    S value(unsigned k, int d) const { return k ? nodes[k].val : pw[d]; }
+
+    S repeat(long long c) const {
+        S r = e;
+        for (int d = 0; c; d++, c >>= 1) {
+            if (c & 1) r = f(r, pw[d]);
+        }
+        return r;
+    }
+
+    unsigned new_node(int d) {
+        nodes.push_back({pw[d], id, {0, 0}});
+        return nodes.size() - 1;
+    }
+
+    void apply_node(unsigned k, const E& x) {
+        nodes[k].val = g(nodes[k].val, x);
+        nodes[k].lz = h(nodes[k].lz, x);
+    }
+
+    void push(unsigned k, int d) {
+        if (nodes[k].lz == id) return;
+        for (int b = 0; b < 2; b++) {
+            if (!nodes[k].ch[b]) {
+                unsigned c = new_node(d - 1);
+                nodes[k].ch[b] = c;
+            }
+            apply_node(nodes[k].ch[b], nodes[k].lz);
+        }
+        nodes[k].lz = id;
+    }
+
+    void pull(unsigned k, int d) {
+        nodes[k].val = f(value(nodes[k].ch[0], d - 1), value(nodes[k].ch[1], d - 1));
+    }
+
+    unsigned update(unsigned k, int d, long long lo, long long a, long long b, const E& x) {
+        long long hi = lo + (1LL << d);
+        if (b <= lo || hi <= a) return k;
+        if (!k) k = new_node(d);
+        if (a <= lo && hi <= b) {
+            apply_node(k, x);
+            return k;
+        }
+        push(k, d);
+        long long mid = lo + (1LL << (d - 1));
+        unsigned l = update(nodes[k].ch[0], d - 1, lo, a, b, x);
+        nodes[k].ch[0] = l;
+        unsigned r = update(nodes[k].ch[1], d - 1, mid, a, b, x);
+        nodes[k].ch[1] = r;
+        pull(k, d);
+        return k;
+    }
+
+    unsigned set(unsigned k, int d, long long i, const S& x) {
+        if (!k) k = new_node(d);
+        if (d == 0) {
+            nodes[k].val = x;
+            return k;
+        }
+        push(k, d);
+        int b = i >> (d - 1) & 1;
+        unsigned c = set(nodes[k].ch[b], d - 1, i, x);
+        nodes[k].ch[b] = c;
+        pull(k, d);
+        return k;
+    }
+
+    S query(unsigned k, int d, long long lo, long long a, long long b) const {
+        long long hi = lo + (1LL << d);
+        a = std::max(a, lo), b = std::min(b, hi);
+        if (a >= b) return e;
+        if (a == lo && b == hi) return value(k, d);
+        if (!k) return repeat(b - a);
+        long long mid = lo + (1LL << (d - 1));
+        S v = f(query(nodes[k].ch[0], d - 1, lo, a, b), query(nodes[k].ch[1], d - 1, mid, a, b));
+        return nodes[k].lz == id ? v : g(v, nodes[k].lz);
+    }
+
+public:
+    DynamicLazySegmentTree(long long n_, F f_, G g_, H h_, S e_, E id_)
+        : DynamicLazySegmentTree(n_, f_, g_, h_, e_, id_, e_) {}
+
+    DynamicLazySegmentTree(long long n_, F f_, G g_, H h_, S e_, E id_, S init)
+        : n(n_), log(0), f(f_), g(g_), h(h_), e(e_), id(id_) {
+        while ((1LL << log) < n) log++;
+        pw.push_back(init);
+        for (int d = 1; d <= log; d++) pw.push_back(f(pw[d - 1], pw[d - 1]));
+        nodes.push_back({e, id, {0, 0}});
+    }
+
+    int node_count() const { return nodes.size() - 1; }
+
+    void update(long long i, const S& x) { root = set(root, log, i, x); }
+
+    void update(long long a, long long b, const E& x) {  // [a, b)
+        if (a >= b) return;
+        root = update(root, log, 0, a, b, x);
+    }
+
+    S operator[](long long i) const { return query(i, i + 1); }
+
+    S query(long long a, long long b) const {  // [a, b)
+        if (a >= b) return e;
+        return query(root, log, 0, a, b);
+    }
+
+    S all_prod() const { return query(0, n); }
+};
+/*
+    // example
+    auto op = [](long long a, long long b) { return a + b; };
+    DynamicSegmentTree<long long, decltype(op)> seg(1'000'000'000'000'000'000LL, op, 0);
+    seg.update(i, x);                   // online, no coordinate compression
+    seg.query(l, r);
+
+    // range add / range sum over [0, 10^18): S = {sum, len}, every leaf starts as {0, 1}
+    using S = std::pair<long long, long long>;
+    auto op = [](S a, S b) -> S { return {a.first + b.first, a.second + b.second}; };
+    auto mapping = [](S a, long long x) -> S { return {a.first + x * a.second, a.second}; };
+    auto composition = [](long long a, long long b) { return a + b; };
+    DynamicLazySegmentTree<S, long long, decltype(op), decltype(mapping), decltype(composition)>
+        seg(1'000'000'000'000'000'000LL, op, mapping, composition, {0, 0}, 0, {0, 1});
+*/
+
+struct FastInput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0, len = 0;
+
+    inline void refill() {
+        len -= pos;
+        std::memmove(buf, buf + pos, len);
+        pos = 0;
+        len += std::fread(buf + len, 1, BUF_SIZE - len, stdin);
+        if (len < BUF_SIZE) buf[len] = '\0';
+    }
+
+    inline char peek() {
+        if (pos == len) refill();
+        return pos < len ? buf[pos] : '\0';
+    }
+
+    inline char skip() {  // skips whitespace, returns the first non-space char ('\0' on EOF)
+        char c;
+        while ((c = peek()) && c <= ' ') pos++;
+        return c;
+    }
+
+public:
+    template <std::integral T>
+    void read(T& x) {
+        skip();
+        if (len - pos < 64) refill();
+        bool neg = false;
+        if constexpr (std::is_signed_v<T>) {
+            if (buf[pos] == '-') neg = true, pos++;
+        }
+        std::make_unsigned_t<T> v = 0;
+        while (pos < len && (unsigned)(buf[pos] - '0') < 10) v = v * 10 + (buf[pos++] - '0');
+        x = neg ? -(T)v : (T)v;
+    }
+
+    void read(char& c) { if ((c = skip())) pos++; }
+
+    void read(std::string& s) {
+        s.clear();
+        for (char c = skip(); c > ' '; c = peek()) s.push_back(c), pos++;
+    }
+
+    void read(double& x) {
+        std::string s;
+        read(s);
+        x = std::stod(s);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); } && std::constructible_from<T, long long>
+    void read(T& x) {  // ModInt
+        long long v;
+        read(v);
+        x = T(v);
+    }
+
+    template <typename T, typename U>
+    void read(std::pair<T, U>& p) { read(p.first), read(p.second); }
+
+    template <typename T>
+    void read(std::vector<T>& v) { for (auto& x : v) read(x); }
+
+    template <typename T>
+    FastInput& operator>>(T& x) { read(x); return *this; }
+};
+
+struct FastOutput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0;
+
+    inline void reserve(int k) {
+        if (pos + k > BUF_SIZE) flush();
+    }
+
+public:
+    ~FastOutput() { flush(); }
+
+    void flush() {
+        std::fwrite(buf, 1, pos, stdout);
+        std::fflush(stdout);
+        pos = 0;
+    }
+
+    template <std::integral T>
+    void write(T x) {
+        reserve(40);
+        std::make_unsigned_t<T> v = x;
+        if constexpr (std::is_signed_v<T>) {
+            if (x < 0) buf[pos++] = '-', v = -v;
+        }
+        char tmp[40];
+        int k = 0;
+        do tmp[k++] = '0' + v % 10; while (v /= 10);
+        while (k) buf[pos++] = tmp[--k];
+    }
+
+    void write(char c) { reserve(1); buf[pos++] = c; }
+
+    void write(const char* s) { write(std::string_view(s)); }
+
+    void write(std::string_view s) {
+        for (size_t i = 0; i < s.size();) {
+            if (pos == BUF_SIZE) flush();
+            size_t k = std::min(s.size() - i, (size_t)(BUF_SIZE - pos));
+            std::memcpy(buf + pos, s.data() + i, k);
+            pos += k, i += k;
+        }
+    }
+
+    void write(double x) {
+        reserve(64);
+        pos += std::snprintf(buf + pos, 64, "%.15f", x);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); }
+    void write(T x) { write(x.value()); }  // ModInt
+
+    template <typename T, typename U>
+    void write(const std::pair<T, U>& p) { write(p.first), write(' '), write(p.second); }
+
+    template <typename T>
+    void write(const std::vector<T>& v) {
+        for (size_t i = 0; i < v.size(); i++) {
+            if (i) write(' ');
+            write(v[i]);
+        }
+    }
+
+    template <typename T>
+    FastOutput& operator<<(const T& x) { write(x); return *this; }
+};
+
+static FastInput in;
+static FastOutput out;
+
+
+// https://judge.yosupo.jp/problem/associative_array
+int main() {
+    int Q;
+    in >> Q;
+
+    auto op = [](long long a, long long b) { return a + b; };
+    DynamicSegmentTree<long long, decltype(op)> seg(1'000'000'000'000'000'001LL, op, 0);
+
+    while (Q--) {
+        int t;
+        long long k;
+        in >> t >> k;
+        if (t == 0) {
+            long long v;
+            in >> v;
+            seg.update(k, v);
+        } else {
+            out << seg[k] << '\n';
+        }
+    }
+
+    return 0;
+}
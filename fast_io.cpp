@@ -0,0 +1,173 @@
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <concepts>
+#include <type_traits>
+
+struct FastInput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0, len = 0;
+
+    inline void refill() {
+        len -= pos;
+        std::memmove(buf, buf + pos, len);
+        pos = 0;
+        len += std::fread(buf + len, 1, BUF_SIZE - len, stdin);
+        if (len < BUF_SIZE) buf[len] = '\0';
+    }
+
+    inline char peek() {
+        if (pos == len) refill();
+        return pos < len ? buf[pos] : '\0';
+    }
+
+    inline char skip() {  // skips whitespace, returns the first non-space char ('\0' on EOF)
+        char c;
+        while ((c = peek()) && c <= ' ') pos++;
+        return c;
+    }
+
+public:
+    template <std::integral T>
+    void read(T& x) {
+        skip();
+        if (len - pos < 64) refill();
+        bool neg = false;
+        if constexpr (std::is_signed_v<T>) {
+            if (buf[pos] == '-') neg = true, pos++;
+        }
+        std::make_unsigned_t<T> v = 0;
+        while (pos < len && (unsigned)(buf[pos] - '0') < 10) v = v * 10 + (buf[pos++] - '0');
+        x = neg ? -(T)v : (T)v;
+    }
+
+    void read(char& c) { if ((c = skip())) pos++; }
+
+    void read(std::string& s) {
+        s.clear();
+        for (char c = skip(); c > ' '; c = peek()) s.push_back(c), pos++;
+    }
+
+    void read(double& x) {
+        std::string s;
+        read(s);
+        x = std::stod(s);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); } && std::constructible_from<T, long long>
+    void read(T& x) {  // ModInt
+        long long v;
+        read(v);
+        x = T(v);
+    }
+
+    template <typename T, typename U>
+    void read(std::pair<T, U>& p) { read(p.first), read(p.second); }
+
+    template <typename T>
+    void read(std::vector<T>& v) { for (auto& x : v) read(x); }
+
+    template <typename T>
+    FastInput& operator>>(T& x) { read(x); return *this; }
+};
+
+struct FastOutput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0;
+
+    inline void reserve(int k) {
+        if (pos + k > BUF_SIZE) flush();
+    }
+
+public:
+    ~FastOutput() { flush(); }
+
+    void flush() {
+        std::fwrite(buf, 1, pos, stdout);
+        std::fflush(stdout);
+        pos = 0;
+    }
+
+    template <std::integral T>
+    void write(T x) {
+        reserve(40);
+        std::make_unsigned_t<T> v = x;
+        if constexpr (std::is_signed_v<T>) {
+            if (x < 0) buf[pos++] = '-', v = -v;
+        }
+        char tmp[40];
+        int k = 0;
+        do tmp[k++] = '0' + v % 10; while (v /= 10);
+        while (k) buf[pos++] = tmp[--k];
+    }
+
+    void write(char c) { reserve(1); buf[pos++] = c; }
+
+    void write(const char* s) { write(std::string_view(s)); }
+
+    void write(std::string_view s) {
+        for (size_t i = 0; i < s.size();) {
+            if (pos == BUF_SIZE) flush();
+            size_t k = std::min(s.size() - i, (size_t)(BUF_SIZE - pos));
+            std::memcpy(buf + pos, s.data() + i, k);
+            pos += k, i += k;
+        }
+    }
+
+    void write(double x) {
+        reserve(64);
+        pos += std::snprintf(buf + pos, 64, "%.15f", x);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); }
+    void write(T x) { write(x.value()); }  // ModInt
+
+    template <typename T, typename U>
+    void write(const std::pair<T, U>& p) { write(p.first), write(' '), write(p.second); }
+
+    template <typename T>
+    void write(const std::vector<T>& v) {
+        for (size_t i = 0; i < v.size(); i++) {
+            if (i) write(' ');
+            write(v[i]);
+        }
+    }
+
+    template <typename T>
+    FastOutput& operator<<(const T& x) { write(x); return *this; }
+};
+
+static FastInput in;
+static FastOutput out;
+/*
+    // example
+    int n; long long a;
+    in >> n >> a;
+    out << a << '\n';   // never use std::endl: it forces a flush per line
+    out.flush();        // optional, also flushed at exit
+*/
+
+
+// https://judge.yosupo.jp/problem/many_aplusb
+int main() {
+    int T;
+    in >> T;
+
+    while (T--) {
+        unsigned long long A, B;
+        in >> A >> B;
+        out << A + B << '\n';
+    }
+
+    return 0;
+}
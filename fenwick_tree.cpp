@@ -1,69 +1,638 @@
-#include <iostream>
 #include <vector>
+#include <span>
+#include <bit>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <utility>
+#include <concepts>
+#include <type_traits>
+#include <new>
+#include <atomic>
+#include <random>
+#include <chrono>
+#include <numeric>
+#include <cassert>
 
+// T: an abelian group under + and - with T() as zero (integers, ModInt, double, ...)
+template <typename T>
+concept FenwickValue = std::default_initializable<T> && requires(T a, T b) {
+    { a + b } -> std::convertible_to<T>;
+    { a - b } -> std::convertible_to<T>;
+    a += b;
+};
+
+template <FenwickValue T = long long>
 struct FenwickTree {
 private:
     int n, p;
-    std::vector<long long> data;
+    std::vector<T> data;
 
 public:
     FenwickTree(int n_) : n(n_), p(1), data(n + 1) {
         while (p * 2 <= n) p *= 2;
     }
 
-    void add(int i, long long value) {
+    // O(n): every node passes its partial sum to its parent once, instead of n calls to add
+    FenwickTree(std::span<const T> a) : FenwickTree(a.size()) {
+        for (int i = 1; i <= n; i++) data[i] += a[i - 1];
+        for (int i = 1; i <= n; i++) {
+            int j = i + (i & -i);
+            if (j <= n) data[j] += data[i];
+        }
+    }
+
+    void add(int i, T value) {
         for (i++; i <= n; i += i & -i) data[i] += value;
     }
 
-    long long sum(int i) const { // [0, i], O(log(n))
-        long long result = 0;
+    T sum(int i) const { // [0, i], O(log(n))
+        T result{};
         for (i++; i; i -= i & -i) result += data[i];
         return result;
     }
 
-    long long range_sum(int left, int right) const {  // [left, right], O(log(n))
-        return sum(right) - (left > 0 ? sum(left - 1) : 0);
+    T range_sum(int left, int right) const {  // [left, right], O(log(n))
+        return left > 0 ? sum(right) - sum(left - 1) : sum(right);
     }
 
-    int lower_bound(long long w) {
+    // smallest x with sum(x) >= w, n if none; all values must be non-negative.
+    // For integral T the step is taken with masks instead of a branch on data (which mispredicts
+    // half the time; GCC turns plain selects back into that branch), and the four nodes the step
+    // after next may read are prefetched while this one resolves. lower_bound<false> is the plain
+    // branching descent, kept for benchmark()
+    template <bool branchless = true>
+    int lower_bound(T w) const requires std::totally_ordered<T> {
+        if (!(T{} < w)) return 0;
+        int x = 0;
+        if constexpr (!branchless) {
+            for (int k = p; k; k >>= 1) {
+                if (x + k <= n && data[x + k] < w) w = w - data[x + k], x += k;
+            }
+            return x;
+        }
+        for (int k = p; k; k >>= 1) {
+            for (int y : {x, x + k}) {
+                __builtin_prefetch(&data[std::min(y + (k >> 2), n)]);
+                __builtin_prefetch(&data[std::min(y + (k >> 1) + (k >> 2), n)]);
+            }
+            const T v = data[std::min(x + k, n)];
+            const bool step = (x + k <= n) & (v < w);
+            if constexpr (std::integral<T>) {
+                w -= v & -(T)step;
+                x += k & -(int)step;
+            } else if (step) {
+                w = w - v, x += k;
+            }
+        }
+        return x;
+    }
+};
+
+template <typename T, std::size_t Align = 64>
+struct AlignedAllocator {
+    using value_type = T;
+    template <typename U> struct rebind { using other = AlignedAllocator<U, Align>; };
+    AlignedAllocator() = default;
+    template <typename U> AlignedAllocator(const AlignedAllocator<U, Align>&) {}
+    T* allocate(std::size_t k) { return static_cast<T*>(::operator new(k * sizeof(T), std::align_val_t(Align))); }
+    void deallocate(T* p, std::size_t) { ::operator delete(p, std::align_val_t(Align)); }
+    bool operator==(const AlignedAllocator&) const { return true; }
+};
+
+// Same interface as FenwickTree<T> for int / long long, laid out as a B-ary tree with one 64-byte
+// block per node (B = 16 for int, 8 for long long). Level 0 holds inclusive prefix sums inside
+// each block of B elements; level h >= 1 holds, for block q of level h - 1, the sum of the blocks
+// before it under the same parent. So
+//   sum(i) = t0[i] + sum over h of t_h[i / B^h]      (log_B n independent loads, no branches)
+//   add(i) = one masked add over one block per level (log_B n lines instead of log2 n)
+//   lower_bound = per level, count the lanes below w in one block and descend
+// The fixed-width block loops are written for the vectorizer.
+template <std::signed_integral T>
+requires (sizeof(T) == 4 || sizeof(T) == 8)
+struct WideFenwickTree {
+private:
+    static constexpr int B = 64 / sizeof(T), LG = std::countr_zero((unsigned)B);
+    int n;
+    T total = 0;
+    std::vector<T, AlignedAllocator<T>> t;
+    std::vector<int> level;  // offset of each level in t, bottom first; the last level is one block
+
+    static int count_below(const T* b, T w) {
+        int c = 0;
+        for (int k = 0; k < B; k++) c += b[k] < w;
+        return c;
+    }
+
+public:
+    WideFenwickTree(int n_) : n(n_) {
+        int size = 0;
+        for (int cnt = std::max(n, 1);; cnt = (cnt + B - 1) / B) {
+            level.push_back(size);
+            size += (cnt + B - 1) / B * B;
+            if (cnt <= B) break;
+        }
+        t.assign(size, 0);
+    }
+
+    WideFenwickTree(std::span<const T> a) : WideFenwickTree(a.size()) {  // O(n)
+        for (T x : a) total += x;
+        std::vector<T> blk(a.begin(), a.end());  // totals of the blocks of the level being filled
+        blk.resize((blk.size() + B - 1) / B * B);
+        for (int h = 0; h < (int)level.size(); h++) {
+            T* d = &t[level[h]];
+            std::vector<T> up(((blk.size() / B) + B - 1) / B * B);
+            for (int q = 0; q < (int)blk.size(); q += B) {
+                T run = 0;
+                for (int k = 0; k < B; k++) {
+                    if (h > 0) d[q + k] = run;
+                    run += blk[q + k];
+                    if (h == 0) d[q + k] = run;
+                }
+                up[q / B] = run;
+            }
+            blk = std::move(up);
+        }
+    }
+
+    void add(int i, T value) {
+        total += value;
+        for (int h = 0; h < (int)level.size(); h++, i >>= LG) {
+            T* b = &t[level[h] + (i & -B)];
+            const int lim = (i & (B - 1)) + (h > 0);
+            for (int k = 0; k < B; k++) b[k] += k >= lim ? value : 0;
+        }
+    }
+
+    T sum(int i) const {  // [0, i]
+        T result = t[i];
+        for (int h = 1; h < (int)level.size(); h++) result += t[level[h] + (i >> (LG * h))];
+        return result;
+    }
+
+    T range_sum(int left, int right) const {  // [left, right]
+        return left > 0 ? sum(right) - sum(left - 1) : sum(right);
+    }
+
+    // smallest x with sum(x) >= w, n if none; all values must be non-negative
+    int lower_bound(T w) const {
+        if (w <= 0) return 0;
+        if (total < w) return n;  // otherwise the descent would enter padding blocks
+        int q = 0;
+        for (int h = level.size() - 1; h > 0; h--) {
+            const T* b = &t[level[h] + (q << LG)];
+            const int c = count_below(b, w) - 1;  // b[0] == 0 < w
+            w -= b[c];
+            q = (q << LG) + c;
+        }
+        return std::min((q << LG) + count_below(&t[q << LG], w), n);
+    }
+};
+
+// FenwickTree<T> for many writer threads and concurrent readers, without locks. add() is a relaxed
+// fetch_add per node. With shards > 1 every thread adds into its own copy (chosen by a per-thread
+// slot, lines apart from the other copies), so writers on different cores never share a line, and
+// reads merge the copies: O(shards log n) per sum.
+// Consistency of sum(i) against concurrent add(j, v), j <= i: the prefix path of i meets exactly one
+// node written by add(j), so every add is counted entirely or not at all, adds that happen-before
+// the sum (e.g. the writer was joined) are counted, and adds that start after it returns are not.
+// It is not linearizable: two sums may see two concurrent adds in opposite orders. range_sum and
+// lower_bound read several paths and are exact only once writers are quiescent.
+template <std::integral T = long long>
+struct ConcurrentFenwickTree {
+private:
+    static constexpr int LINE = 64 / sizeof(T);
+    int n, p, shards, stride;
+    std::vector<std::atomic<T>> data;  // copy s at [s * stride, s * stride + n], a spare line between copies
+
+    static int thread_slot() {
+        static std::atomic<int> next{0};
+        thread_local int slot = next.fetch_add(1, std::memory_order_relaxed);
+        return slot;
+    }
+
+    T load(int k) const { return data[k].load(std::memory_order_relaxed); }
+
+public:
+    ConcurrentFenwickTree(int n_, int shards_ = 1)
+        : n(n_), p(1), shards(shards_), stride((n_ + 1 + LINE - 1) / LINE * LINE + LINE),
+          data((size_t)stride * shards_) {
+        while (p * 2 <= n) p *= 2;
+    }
+
+    void add(int i, T value) {
+        std::atomic<T>* d = data.data() + (shards == 1 ? 0 : (size_t)(thread_slot() % shards) * stride);
+        for (i++; i <= n; i += i & -i) d[i].fetch_add(value, std::memory_order_relaxed);
+    }
+
+    T sum(int i) const {  // [0, i]
+        T result = 0;
+        for (int s = 0; s < shards; s++) {
+            for (int k = i + 1; k; k -= k & -k) result += load(s * stride + k);
+        }
+        return result;
+    }
+
+    T range_sum(int left, int right) const {  // [left, right]
+        return left > 0 ? sum(right) - sum(left - 1) : sum(right);
+    }
+
+    int lower_bound(T w) const {  // as FenwickTree::lower_bound
         if (w <= 0) return 0;
         int x = 0;
         for (int k = p; k; k /= 2) {
-            if (x + k <= n && data[x + k] < w) {
-                w -= data[x + k], x += k;
-            }
+            if (x + k > n) continue;
+            T v = 0;
+            for (int s = 0; s < shards; s++) v += load(s * stride + x + k);
+            if (v < w) w -= v, x += k;
         }
         return x;
     }
 };
 
+// range add / range sum with two trees: with d = the difference array of a,
+// sum a[0, i] = (i + 1) * sum d[0, i] - sum j * d[j] for j in [0, i]
+template <FenwickValue T = long long>
+requires std::constructible_from<T, long long> && requires(T a, T b) { { a * b } -> std::convertible_to<T>; }
+struct RangeFenwickTree {
+private:
+    int n;
+    FenwickTree<T> d, jd;  // d[j], j * d[j]
+
+    static std::vector<T> diff(std::span<const T> a, bool weighted) {  // d[j] (or j * d[j]), length n + 1
+        std::vector<T> r(a.size() + 1);
+        for (int j = 0; j < (int)a.size(); j++) {
+            T dj = j ? a[j] - a[j - 1] : a[0];
+            r[j] = weighted ? dj * T(j) : dj;
+        }
+        return r;
+    }
+
+public:
+    RangeFenwickTree(int n_) : n(n_), d(n_ + 1), jd(n_ + 1) {}
+
+    RangeFenwickTree(std::span<const T> a)
+        : n(a.size()), d(std::span<const T>(diff(a, false))), jd(std::span<const T>(diff(a, true))) {}
+
+    void add(int left, int right, T value) {  // [left, right], O(log(n))
+        d.add(left, value);
+        d.add(right + 1, T{} - value);
+        jd.add(left, value * T(left));
+        jd.add(right + 1, T{} - value * T(right + 1));
+    }
+
+    T sum(int i) const {  // [0, i], O(log(n))
+        return d.sum(i) * T(i + 1) - jd.sum(i);
+    }
+
+    T range_sum(int left, int right) const {  // [left, right], O(log(n))
+        return left > 0 ? sum(right) - sum(left - 1) : sum(right);
+    }
+};
+
+// dense h x w point add / rectangle sum, O(log(h) log(w)) per operation
+template <FenwickValue T = long long>
+struct FenwickTree2D {
+private:
+    int h, w;
+    std::vector<T> data;  // (h + 1) x (w + 1), row-major
+
+public:
+    FenwickTree2D(int h_, int w_) : h(h_), w(w_), data((size_t)(h + 1) * (w + 1)) {}
+
+    void add(int x, int y, T value) {
+        for (int i = x + 1; i <= h; i += i & -i) {
+            for (int j = y + 1; j <= w; j += j & -j) data[(size_t)i * (w + 1) + j] += value;
+        }
+    }
+
+    T sum(int x, int y) const {  // [0, x] x [0, y]
+        T result{};
+        for (int i = x + 1; i; i -= i & -i) {
+            for (int j = y + 1; j; j -= j & -j) result += data[(size_t)i * (w + 1) + j];
+        }
+        return result;
+    }
+
+    T range_sum(int x1, int y1, int x2, int y2) const {  // [x1, x2] x [y1, y2]
+        T result = sum(x2, y2);
+        if (x1 > 0) result = result - sum(x1 - 1, y2);
+        if (y1 > 0) result = result - sum(x2, y1 - 1);
+        if (x1 > 0 && y1 > 0) result += sum(x1 - 1, y1 - 1);
+        return result;
+    }
+};
+
+// point add / rectangle sum over arbitrary coordinates, with every point that will ever be added to
+// given up front. Node i of the tree over x keeps the sorted y of the points it covers (all rows
+// in one array), so memory is O(k log k) for k points and each operation is O(log^2 k)
+template <FenwickValue T = long long, typename K = long long>
+struct OfflineFenwickTree2D {
+private:
+    std::vector<K> xs;
+    std::vector<int> start;  // node i owns ys / data [start[i], start[i + 1])
+    std::vector<K> ys;
+    std::vector<T> data;
+
+    int row(int i, K y) const {  // #{y' < y} in node i
+        return std::lower_bound(ys.begin() + start[i], ys.begin() + start[i + 1], y) - (ys.begin() + start[i]);
+    }
+
+public:
+    OfflineFenwickTree2D(std::span<const std::pair<K, K>> points) {
+        for (auto& [x, y] : points) xs.push_back(x);
+        std::sort(xs.begin(), xs.end());
+        xs.erase(std::unique(xs.begin(), xs.end()), xs.end());
+        const int m = xs.size();
+        std::vector<std::vector<K>> col(m + 1);
+        for (auto& [x, y] : points) {
+            for (int i = std::lower_bound(xs.begin(), xs.end(), x) - xs.begin() + 1; i <= m; i += i & -i) {
+                col[i].push_back(y);
+            }
+        }
+        start.assign(m + 2, 0);
+        for (int i = 1; i <= m; i++) {
+            std::sort(col[i].begin(), col[i].end());
+            col[i].erase(std::unique(col[i].begin(), col[i].end()), col[i].end());
+            start[i + 1] = start[i] + col[i].size();
+            ys.insert(ys.end(), col[i].begin(), col[i].end());
+        }
+        data.assign(ys.size(), T{});
+    }
+
+    void add(K x, K y, T value) {  // (x, y) must be one of the points given to the constructor
+        const int m = xs.size();
+        for (int i = std::lower_bound(xs.begin(), xs.end(), x) - xs.begin() + 1; i <= m; i += i & -i) {
+            T* d = &data[start[i]] - 1;  // the tree inside node i is 1-indexed
+            const int len = start[i + 1] - start[i];
+            for (int j = row(i, y) + 1; j <= len; j += j & -j) d[j] += value;
+        }
+    }
+
+    T sum(K x, K y) const {  // points with x' < x and y' < y
+        T result{};
+        for (int i = std::lower_bound(xs.begin(), xs.end(), x) - xs.begin(); i; i -= i & -i) {
+            const T* d = &data[start[i]] - 1;
+            for (int j = row(i, y); j; j -= j & -j) result += d[j];
+        }
+        return result;
+    }
+
+    T rectangle_sum(K xl, K xr, K yl, K yr) const {  // [xl, xr) x [yl, yr)
+        return sum(xr, yr) - sum(xl, yr) - sum(xr, yl) + sum(xl, yl);
+    }
+};
+/*
+    // example
+    FenwickTree<long long> f(A);                    // O(n)
+    f.add(i, x);
+    f.range_sum(l, r);                              // [l, r]
+
+    FenwickTree<mint> g(n);                         // any abelian group: ModInt, double, ...
+
+    WideFenwickTree<long long> wf(A);               // int / long long, large n and lower_bound heavy
+    f.lower_bound<false>(w);                        // plain branching descent, for comparison
+
+    ConcurrentFenwickTree<long long> cf(n, std::thread::hardware_concurrency());
+    cf.add(i, x);                                   // from any thread, no lock
+    cf.sum(i);                                      // from any thread, see the consistency note
+
+    RangeFenwickTree<long long> rf(A);
+    rf.add(l, r, x);                                // a[i] += x for i in [l, r]
+    rf.range_sum(l, r);
+
+    FenwickTree2D<int> f2(h, w);
+    f2.add(x, y, v);
+    f2.range_sum(x1, y1, x2, y2);                   // [x1, x2] x [y1, y2]
+
+    OfflineFenwickTree2D<long long> of(points);     // every (x, y) that add() will use
+    of.add(x, y, w);
+    of.rectangle_sum(l, r, d, u);                   // [l, r) x [d, u)
+*/
+
+
+// 1e6 random lower_bound / sum / add on long long values in [0, 1000), best of 3, in ms.
+// old = FenwickTree::lower_bound<false>; compile with -march=native for the vectorized wide blocks
+void benchmark() {
+    using ll = long long;
+    constexpr int Q = 1000000;
+    std::printf("%10s %28s %18s %18s\n", "", "lower_bound [ms]", "sum [ms]", "add [ms]");
+    std::printf("%10s %9s %9s %8s %9s %8s %9s %8s\n", "n", "old", "new", "wide", "fenwick", "wide", "fenwick", "wide");
+    for (int n : {10000, 1000000, 10000000, 100000000}) {
+        std::mt19937_64 rng(1);
+        std::vector<ll> a(n);
+        for (ll& x : a) x = rng() % 1000;
+        const ll total = std::accumulate(a.begin(), a.end(), 0LL);
+        std::vector<ll> ws(Q);
+        std::vector<int> is(Q);
+        for (ll& w : ws) w = rng() % total + 1;
+        for (int& i : is) i = rng() % n;
+
+        ll chk = 0;
+        auto time = [&](auto fn) {
+            double best = 1e18;
+            for (int r = 0; r < 3; r++) {
+                chk = 0;
+                auto st = std::chrono::steady_clock::now();
+                fn();
+                best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - st).count());
+            }
+            return best;
+        };
+        double t[7];
+        ll lb[3], sm[2];  // checksums, compared below (this also keeps the loops from being dropped)
+        {  // one tree at a time: at n = 1e8 each holds 800 MB
+            FenwickTree<ll> f(a);
+            t[0] = time([&] { for (ll w : ws) chk += f.lower_bound<false>(w); }), lb[0] = chk;
+            t[1] = time([&] { for (ll w : ws) chk += f.lower_bound(w); }), lb[1] = chk;
+            t[3] = time([&] { for (int i : is) chk += f.sum(i); }), sm[0] = chk;
+            t[5] = time([&] { for (int i : is) f.add(i, 1); });
+        }
+        {
+            WideFenwickTree<ll> wf(a);
+            t[2] = time([&] { for (ll w : ws) chk += wf.lower_bound(w); }), lb[2] = chk;
+            t[4] = time([&] { for (int i : is) chk += wf.sum(i); }), sm[1] = chk;
+            t[6] = time([&] { for (int i : is) wf.add(i, 1); });
+        }
+        assert(lb[0] == lb[1] && lb[1] == lb[2] && sm[0] == sm[1]);
+        std::printf("%10d %9.1f %9.1f %8.1f %9.1f %8.1f %9.1f %8.1f\n", n, t[0], t[1], t[2], t[3], t[4], t[5], t[6]);
+    }
+}
+
+
+struct FastInput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0, len = 0;
+
+    inline void refill() {
+        len -= pos;
+        std::memmove(buf, buf + pos, len);
+        pos = 0;
+        len += std::fread(buf + len, 1, BUF_SIZE - len, stdin);
+        if (len < BUF_SIZE) buf[len] = '\0';
+    }
+
+    inline char peek() {
+        if (pos == len) refill();
+        return pos < len ? buf[pos] : '\0';
+    }
+
+    inline char skip() {  // skips whitespace, returns the first non-space char ('\0' on EOF)
+        char c;
+        while ((c = peek()) && c <= ' ') pos++;
+        return c;
+    }
+
+public:
+    template <std::integral T>
+    void read(T& x) {
+        skip();
+        if (len - pos < 64) refill();
+        bool neg = false;
+        if constexpr (std::is_signed_v<T>) {
+            if (buf[pos] == '-') neg = true, pos++;
+        }
+        std::make_unsigned_t<T> v = 0;
+        while (pos < len && (unsigned)(buf[pos] - '0') < 10) v = v * 10 + (buf[pos++] - '0');
+        x = neg ? -(T)v : (T)v;
+    }
+
+    void read(char& c) { if ((c = skip())) pos++; }
+
+    void read(std::string& s) {
+        s.clear();
+        for (char c = skip(); c > ' '; c = peek()) s.push_back(c), pos++;
+    }
+
+    void read(double& x) {
+        std::string s;
+        read(s);
+        x = std::stod(s);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); } && std::constructible_from<T, long long>
+    void read(T& x) {  // ModInt
+        long long v;
+        read(v);
+        x = T(v);
+    }
+
+    template <typename T, typename U>
+    void read(std::pair<T, U>& p) { read(p.first), read(p.second); }
+
+    template <typename T>
+    void read(std::vector<T>& v) { for (auto& x : v) read(x); }
+
+    template <typename T>
+    FastInput& operator>>(T& x) { read(x); return *this; }
+};
+
+struct FastOutput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0;
+
+    inline void reserve(int k) {
+        if (pos + k > BUF_SIZE) flush();
+    }
+
+public:
+    ~FastOutput() { flush(); }
+
+    void flush() {
+        std::fwrite(buf, 1, pos, stdout);
+        std::fflush(stdout);
+        pos = 0;
+    }
+
+    template <std::integral T>
+    void write(T x) {
+        reserve(40);
+        std::make_unsigned_t<T> v = x;
+        if constexpr (std::is_signed_v<T>) {
+            if (x < 0) buf[pos++] = '-', v = -v;
+        }
+        char tmp[40];
+        int k = 0;
+        do tmp[k++] = '0' + v % 10; while (v /= 10);
+        while (k) buf[pos++] = tmp[--k];
+    }
+
+    void write(char c) { reserve(1); buf[pos++] = c; }
+
+    void write(const char* s) { write(std::string_view(s)); }
+
+    void write(std::string_view s) {
+        for (size_t i = 0; i < s.size();) {
+            if (pos == BUF_SIZE) flush();
+            size_t k = std::min(s.size() - i, (size_t)(BUF_SIZE - pos));
+            std::memcpy(buf + pos, s.data() + i, k);
+            pos += k, i += k;
+        }
+    }
+
+    void write(double x) {
+        reserve(64);
+        pos += std::snprintf(buf + pos, 64, "%.15f", x);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); }
+    void write(T x) { write(x.value()); }  // ModInt
+
+    template <typename T, typename U>
+    void write(const std::pair<T, U>& p) { write(p.first), write(' '), write(p.second); }
+
+    template <typename T>
+    void write(const std::vector<T>& v) {
+        for (size_t i = 0; i < v.size(); i++) {
+            if (i) write(' ');
+            write(v[i]);
+        }
+    }
+
+    template <typename T>
+    FastOutput& operator<<(const T& x) { write(x); return *this; }
+};
+
+static FastInput in;
+static FastOutput out;
+
 
 // https://atcoder.jp/contests/practice2/tasks/practice2_b
-int main() {
+int main(int argc, char** argv) {
+    if (argc > 1 && std::string_view(argv[1]) == "bench") {
+        benchmark();
+        return 0;
+    }
+
     int N, Q;
-    std::cin >> N >> Q;
+    in >> N >> Q;
 
-    FenwickTree f(N);
+    std::vector<long long> A(N);
+    in >> A;
 
-    for (int i = 0; i < N; i++) {
-        long long a;
-        std::cin >> a;
-        f.add(i, a);
-    }
+    FenwickTree<long long> f(A);
 
     while (Q--) {
         int query_type;
-        std::cin >> query_type;
+        in >> query_type;
 
         if (query_type == 0) {
             int p;
             long long x;
-            std::cin >> p >> x;
+            in >> p >> x;
             f.add(p, x);
         } else {
             int l, r;
-            std::cin >> l >> r;
-            std::cout << f.range_sum(l, r - 1) << std::endl;
+            in >> l >> r;
+            out << f.range_sum(l, r - 1) << '\n';
         }
     }
     
@@ -0,0 +1,628 @@
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <random>
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <type_traits>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <concepts>
+
+constexpr int MOD1 = 1000000007;
+constexpr int MOD2 = 998244353;
+
+template <int mod>
+struct MontgomeryModInt {  // odd compile-time modulus < 2^30, same interface as ModInt
+	static_assert(mod & 1 && mod < (1 << 30));
+
+private:
+	using u32 = unsigned int;
+	using u64 = unsigned long long;
+
+	static constexpr u32 get_r() {  // -mod^{-1} mod 2^32
+		u32 inv = mod;
+		for (int i = 0; i < 4; i++) inv *= 2 - mod * inv;
+		return -inv;
+	}
+	static constexpr u32 neg_inv = get_r();
+	static constexpr u32 n2 = -u64(mod) % mod;  // 2^64 mod mod
+
+	static constexpr u32 reduce(u64 b) {  // b * 2^-32 mod mod, result in [0, 2 * mod)
+		return (b + u64(u32(b) * neg_inv) * mod) >> 32;
+	}
+
+	u32 x;  // x * 2^32 mod mod, kept in [0, mod)
+
+public:
+	MontgomeryModInt() : x(0) {}
+	MontgomeryModInt(long long x_) : x(reduce(u64(x_ % mod + mod) * n2)) { if (x >= mod) x -= mod; }
+
+	constexpr MontgomeryModInt& operator+=(MontgomeryModInt rhs) { if ((x += rhs.x) >= mod) x -= mod; return *this; }
+	constexpr MontgomeryModInt& operator-=(MontgomeryModInt rhs) { if ((x += mod - rhs.x) >= mod) x -= mod; return *this; }
+	constexpr MontgomeryModInt& operator*=(MontgomeryModInt rhs) { if ((x = reduce(u64(x) * rhs.x)) >= mod) x -= mod; return *this; }
+	constexpr MontgomeryModInt& operator/=(MontgomeryModInt rhs) { return *this *= rhs.inv(); }
+
+	constexpr MontgomeryModInt operator-() const noexcept { return MontgomeryModInt() - *this; }
+	constexpr MontgomeryModInt operator+(MontgomeryModInt rhs) const noexcept { return MontgomeryModInt(*this) += rhs; }
+	constexpr MontgomeryModInt operator-(MontgomeryModInt rhs) const noexcept { return MontgomeryModInt(*this) -= rhs; }
+	constexpr MontgomeryModInt operator*(MontgomeryModInt rhs) const noexcept { return MontgomeryModInt(*this) *= rhs; }
+	constexpr MontgomeryModInt operator/(MontgomeryModInt rhs) const noexcept { return MontgomeryModInt(*this) /= rhs; }
+
+	constexpr MontgomeryModInt& operator++() { *this += 1; return *this; }
+	constexpr MontgomeryModInt operator++(int) { *this += 1; return *this - 1; }
+	constexpr MontgomeryModInt& operator--() { *this -= 1; return *this; }
+	constexpr MontgomeryModInt operator--(int) { *this -= 1; return *this + 1; }
+
+	bool operator==(MontgomeryModInt rhs) const { return x == rhs.x; }
+	bool operator!=(MontgomeryModInt rhs) const { return x != rhs.x; }
+	bool operator<=(MontgomeryModInt rhs) const { return value() <= rhs.value(); }
+	bool operator>=(MontgomeryModInt rhs) const { return value() >= rhs.value(); }
+	bool operator<(MontgomeryModInt rhs) const { return value() < rhs.value(); }
+	bool operator>(MontgomeryModInt rhs) const { return value() > rhs.value(); }
+
+	friend std::istream& operator>>(std::istream& s, MontgomeryModInt& a) { long long v; s >> v; a = v; return s; }
+	friend std::ostream& operator<<(std::ostream& s, MontgomeryModInt a) { s << a.value(); return s; }
+
+	int value() const {
+		u32 v = reduce(x);
+		return v >= mod ? v - mod : v;
+	}
+
+	MontgomeryModInt inv() const {
+		int a = value(), b = mod, u = 1, v = 0, t;
+		while (b > 0) { t = a / b, std::swap(a -= t * b, b), std::swap(u -= t * v, v); }
+		return MontgomeryModInt(u);
+	}
+
+	MontgomeryModInt pow(long long n) const {
+		MontgomeryModInt ret(1), mul(*this);
+		while (n > 0) { if (n & 1) ret *= mul; mul *= mul; n >>= 1; }
+		return ret;
+	}
+
+	int sqrt() const {
+		if (value() <= 1) return value();
+		if (pow((mod - 1) / 2) != 1) return -1;
+
+		int q = mod - 1, m = 0;
+		std::mt19937 mt;
+		MontgomeryModInt z = mt();
+
+		while (~q & 1) q >>= 1, m++;
+		while (z.pow((mod - 1) / 2) != mod - 1) z = mt();
+
+		MontgomeryModInt c = z.pow(q);
+		MontgomeryModInt t = pow(q);
+		MontgomeryModInt r = pow((q + 1) / 2);
+
+		for (; m > 1; m--) {
+			MontgomeryModInt tmp = t.pow(1 << (m - 2));
+			if (tmp != 1) r = r * c, t = t * c * c;
+			c = c * c;
+		}
+
+		return std::min(r.value(), mod - r.value());
+	}
+};
+
+constexpr int primitive_root(int m) {
+    if (m == 2) return 1;
+    int divs[20] = {2}, cnt = 1;
+    int x = (m - 1) / 2;
+    while (x % 2 == 0) x /= 2;
+    for (int i = 3; (long long)i * i <= x; i += 2) {
+        if (x % i == 0) {
+            divs[cnt++] = i;
+            while (x % i == 0) x /= i;
+        }
+    }
+    if (x > 1) divs[cnt++] = x;
+    for (int g = 2;; g++) {
+        bool ok = true;
+        for (int i = 0; i < cnt && ok; i++) {
+            long long r = 1, b = g, e = (m - 1) / divs[i];
+            for (; e; e >>= 1, b = b * b % m) if (e & 1) r = r * b % m;
+            ok = r != 1;
+        }
+        if (ok) return g;
+    }
+}
+
+template <int mod>
+struct NTT {
+    using mint = MontgomeryModInt<mod>;
+    static constexpr int g = primitive_root(mod);
+    static constexpr int rank2 = std::countr_zero((unsigned int)(mod - 1));  // max transform size is 2^rank2
+
+private:
+    // w[len + j] = (2len-th root)^j for every power of two len, shared by all sizes up to w.size()
+    static inline std::vector<mint> w{0, 1}, iw{0, 1};
+
+    static void prepare(int n) {
+        for (int len = w.size(); len < n; len <<= 1) {
+            mint r = mint(g).pow((mod - 1) / (len << 1)), ir = r.inv();
+            w.resize(len << 1), iw.resize(len << 1);
+            w[len] = iw[len] = 1;
+            for (int j = 1; j < len; j++) w[len + j] = w[len + j - 1] * r, iw[len + j] = iw[len + j - 1] * ir;
+        }
+    }
+
+public:
+    // natural order in, bit-reversed order out (Gentleman-Sande), so no permutation pass is needed;
+    // two levels are fused per pass while at least two remain
+    static void transform(std::vector<mint>& a) {
+        const int n = a.size();
+        prepare(n);
+        int len = n >> 1;
+        for (; len >= 2; len >>= 2) {
+            const int q = len >> 1;
+            const mint* t1 = w.data() + len;
+            const mint* t2 = w.data() + q;
+            for (int i = 0; i < n; i += len << 1) {
+                mint* p = a.data() + i;
+                for (int j = 0; j < q; j++) {
+                    mint a0 = p[j], a1 = p[j + q], a2 = p[j + 2 * q], a3 = p[j + 3 * q];
+                    mint b0 = a0 + a2, b1 = a1 + a3;
+                    mint b2 = (a0 - a2) * t1[j], b3 = (a1 - a3) * t1[j + q];
+                    p[j] = b0 + b1;
+                    p[j + q] = (b0 - b1) * t2[j];
+                    p[j + 2 * q] = b2 + b3;
+                    p[j + 3 * q] = (b2 - b3) * t2[j];
+                }
+            }
+        }
+        if (len == 1) {
+            for (int i = 0; i < n; i += 2) {
+                mint u = a[i], v = a[i + 1];
+                a[i] = u + v;
+                a[i + 1] = u - v;
+            }
+        }
+    }
+
+    // bit-reversed order in, natural order out (Cooley-Tukey), scaled by 1/n
+    static void inverse_transform(std::vector<mint>& a) {
+        const int n = a.size();
+        prepare(n);
+        int len = 1;
+        if (std::countr_zero((unsigned int)n) & 1) {
+            for (int i = 0; i < n; i += 2) {
+                mint u = a[i], v = a[i + 1];
+                a[i] = u + v;
+                a[i + 1] = u - v;
+            }
+            len = 2;
+        }
+        for (; len < n; len <<= 2) {
+            const int q = len;
+            const mint* t1 = iw.data() + q;
+            const mint* t2 = iw.data() + (q << 1);
+            for (int i = 0; i < n; i += len << 2) {
+                mint* p = a.data() + i;
+                for (int j = 0; j < q; j++) {
+                    mint a0 = p[j], a1 = p[j + q] * t1[j], a2 = p[j + 2 * q], a3 = p[j + 3 * q] * t1[j];
+                    mint b0 = a0 + a1, b1 = a0 - a1, b2 = (a2 + a3) * t2[j], b3 = (a2 - a3) * t2[j + q];
+                    p[j] = b0 + b2;
+                    p[j + 2 * q] = b0 - b2;
+                    p[j + q] = b1 + b3;
+                    p[j + 3 * q] = b1 - b3;
+                }
+            }
+        }
+        const mint inv_n = mint(n).inv();
+        for (mint& x : a) x *= inv_n;
+    }
+};
+
+template <int mod>
+std::vector<MontgomeryModInt<mod>> convolution(std::vector<MontgomeryModInt<mod>> a, std::vector<MontgomeryModInt<mod>> b) {
+    using mint = MontgomeryModInt<mod>;
+    const int n = a.size(), m = b.size();
+    if (!n || !m) return {};
+    if (std::min(n, m) <= 60) {
+        std::vector<mint> c(n + m - 1);
+        for (int i = 0; i < n; i++) for (int j = 0; j < m; j++) c[i + j] += a[i] * b[j];
+        return c;
+    }
+    const int sz = std::bit_ceil((unsigned int)(n + m - 1));
+    assert(std::countr_zero((unsigned int)sz) <= NTT<mod>::rank2);
+    a.resize(sz), b.resize(sz);
+    NTT<mod>::transform(a);
+    NTT<mod>::transform(b);
+    for (int i = 0; i < sz; i++) a[i] *= b[i];
+    NTT<mod>::inverse_transform(a);
+    a.resize(n + m - 1);
+    return a;
+}
+
+template <typename T> struct mod_of;
+template <int mod> struct mod_of<MontgomeryModInt<mod>> { static constexpr int value = mod; };
+
+template <typename mint>
+struct FormalPowerSeries : std::vector<mint> {
+private:
+    static constexpr int mod = mod_of<mint>::value;
+    using FPS = FormalPowerSeries;
+    using NTT = ::NTT<mod>;
+
+    // first min(n, size) coefficients of a, zero-padded to sz
+    static std::vector<mint> slice(const std::vector<mint>& a, int n, int sz) {
+        std::vector<mint> r(sz);
+        std::copy(a.begin(), a.begin() + std::min<int>(n, a.size()), r.begin());
+        return r;
+    }
+
+    static void multiply(std::vector<mint>& a, const std::vector<mint>& b) {  // pointwise, both transformed
+        for (size_t i = 0; i < a.size(); i++) a[i] *= b[i];
+    }
+
+    // one Newton step for 1/f: h = 1/f mod x^d, H = transform of h padded to 2d
+    // extends h to 1/f mod x^{2d}; a size-2d cyclic product is enough since the wrapped terms land in [0, d)
+    static void inv_step(const std::vector<mint>& f, FPS& h, const std::vector<mint>& H, int d) {
+        std::vector<mint> t = slice(f, d << 1, d << 1);
+        NTT::transform(t);
+        multiply(t, H);
+        NTT::inverse_transform(t);
+        std::fill(t.begin(), t.begin() + d, mint());
+        NTT::transform(t);
+        multiply(t, H);
+        NTT::inverse_transform(t);
+        h.resize(d << 1);
+        for (int i = d; i < (d << 1); i++) h[i] = -t[i];
+    }
+
+    static std::vector<mint> inverses(int n) {  // 1/i for i < n
+        std::vector<mint> r(std::max(n, 2));
+        r[1] = 1;
+        for (int i = 2; i < n; i++) r[i] = -r[mod % i] * mint(mod / i);
+        return r;
+    }
+
+public:
+    using std::vector<mint>::vector;
+    FormalPowerSeries(const std::vector<mint>& v) : std::vector<mint>(v) {}
+
+    FPS pre(int n) const { FPS r(this->begin(), this->begin() + std::min<int>(n, this->size())); r.resize(n); return r; }
+
+    FPS& operator+=(const FPS& rhs) {
+        if (rhs.size() > this->size()) this->resize(rhs.size());
+        for (size_t i = 0; i < rhs.size(); i++) (*this)[i] += rhs[i];
+        return *this;
+    }
+    FPS& operator-=(const FPS& rhs) {
+        if (rhs.size() > this->size()) this->resize(rhs.size());
+        for (size_t i = 0; i < rhs.size(); i++) (*this)[i] -= rhs[i];
+        return *this;
+    }
+    FPS& operator*=(const FPS& rhs) { return *this = convolution<mod>(*this, rhs); }
+    FPS& operator*=(mint c) { for (mint& x : *this) x *= c; return *this; }
+
+    FPS operator+(const FPS& rhs) const { return FPS(*this) += rhs; }
+    FPS operator-(const FPS& rhs) const { return FPS(*this) -= rhs; }
+    FPS operator*(const FPS& rhs) const { return FPS(*this) *= rhs; }
+    FPS operator*(mint c) const { return FPS(*this) *= c; }
+
+    FPS diff() const {
+        if (this->size() <= 1) return {};
+        FPS r(this->size() - 1);
+        for (size_t i = 1; i < this->size(); i++) r[i - 1] = (*this)[i] * mint(i);
+        return r;
+    }
+
+    FPS integral() const {
+        const int n = this->size();
+        const std::vector<mint> iv = inverses(n + 1);
+        FPS r(n + 1);
+        for (int i = 0; i < n; i++) r[i + 1] = (*this)[i] * iv[i + 1];
+        return r;
+    }
+
+    // 1/f mod x^deg, requires f[0] != 0
+    FPS inv(int deg = -1) const {
+        assert(!this->empty() && (*this)[0] != 0);
+        if (deg == -1) deg = this->size();
+        FPS h{(*this)[0].inv()};
+        for (int d = 1; d < deg; d <<= 1) {
+            std::vector<mint> H = slice(h, d, d << 1);
+            NTT::transform(H);
+            inv_step(*this, h, H, d);
+        }
+        h.resize(deg);
+        return h;
+    }
+
+    // log f mod x^deg, requires f[0] == 1
+    FPS log(int deg = -1) const {
+        assert(!this->empty() && (*this)[0] == 1);
+        if (deg == -1) deg = this->size();
+        if (deg <= 1) return FPS(deg);
+        return (pre(deg).diff() * inv(deg)).pre(deg - 1).integral();
+    }
+
+    // exp f mod x^deg, requires f[0] == 0
+    // keeps g = exp f and h = 1/g side by side so every doubling step is a fixed set of size-2d transforms:
+    // with q = f', log g - f = int (q + h (g' - g q)) - f, and only its [d, 2d) part is nonzero
+    FPS exp(int deg = -1) const {
+        assert(this->empty() || (*this)[0] == 0);
+        if (deg == -1) deg = this->size();
+        const FPS df = pre(deg).diff();
+        const std::vector<mint> iv = inverses(deg << 1);
+        FPS g{1}, h{1};
+        for (int d = 1; d < deg; d <<= 1) {
+            const int sz = d << 1;
+            std::vector<mint> G = slice(g, d, sz), H = slice(h, d, sz), t = slice(df, sz - 1, sz);
+            NTT::transform(G);
+            NTT::transform(H);
+
+            // t = h (g' - g q) on [d - 1, 2d - 1); g' vanishes there and g' - g q vanishes below it
+            NTT::transform(t);
+            multiply(t, G);
+            NTT::inverse_transform(t);
+            std::fill(t.begin(), t.begin() + d - 1, mint());
+            for (int i = d - 1; i < sz - 1; i++) t[i] = -t[i];
+            t[sz - 1] = 0;
+            NTT::transform(t);
+            multiply(t, H);
+            NTT::inverse_transform(t);
+
+            // s = log g - f = x^d (...), g <- g (1 - s)
+            std::vector<mint> s(sz);
+            for (int i = d; i < sz; i++) s[i] = t[i - 1] * iv[i];
+            NTT::transform(s);
+            multiply(s, G);
+            NTT::inverse_transform(s);
+            g.resize(sz);
+            for (int i = d; i < sz; i++) g[i] = -s[i];
+
+            if (sz < deg) inv_step(g, h, H, d);
+        }
+        g.resize(deg);
+        return g;
+    }
+
+    // f^k mod x^deg
+    FPS pow(long long k, int deg = -1) const {
+        if (deg == -1) deg = this->size();
+        if (k == 0) {
+            FPS r(deg);
+            if (deg) r[0] = 1;
+            return r;
+        }
+        int i = 0;
+        while (i < (int)this->size() && (*this)[i] == 0) i++;
+        if (i == (int)this->size() || (__int128)i * k >= deg) return FPS(deg);
+
+        const mint c = (*this)[i], ic = c.inv();
+        const int n = deg - i * k;
+        FPS g(this->begin() + i, this->begin() + std::min<long long>(this->size(), i + n));
+        g *= ic;
+        g = (g.log(n) * mint(k % mod)).exp(n) * c.pow(k);
+
+        FPS r(deg);
+        std::copy(g.begin(), g.end(), r.begin() + i * k);
+        return r;
+    }
+
+    // some g with g^2 = f mod x^deg, or an empty series if none exists
+    FPS sqrt(int deg = -1) const {
+        if (deg == -1) deg = this->size();
+        int i = 0;
+        while (i < (int)this->size() && (*this)[i] == 0) i++;
+        if (i == (int)this->size() || i >= deg) return FPS(deg);
+        if (i & 1) return {};
+        const int s = (*this)[i].sqrt();
+        if (s == -1) return {};
+
+        const FPS f(this->begin() + i, this->end());
+        const int n = deg - i / 2;
+        const mint inv2 = mint(2).inv();
+        FPS g{s};
+        for (int d = 1; d < n; d <<= 1) {
+            g = (g + (f.pre(d << 1) * g.inv(d << 1)).pre(d << 1)) * inv2;
+        }
+
+        FPS r(deg);
+        std::copy(g.begin(), g.begin() + n, r.begin() + i / 2);
+        return r;
+    }
+};
+/*
+    // example
+    using mint = MontgomeryModInt<MOD2>;
+    using FPS = FormalPowerSeries<mint>;
+    FPS f = {1, 2, 3};
+    FPS g = f.inv(n), h = f.log(n), e = (f - FPS{1}).exp(n), p = f.pow(k, n), r = f.sqrt(n);
+*/
+
+
+struct FastInput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0, len = 0;
+
+    inline void refill() {
+        len -= pos;
+        std::memmove(buf, buf + pos, len);
+        pos = 0;
+        len += std::fread(buf + len, 1, BUF_SIZE - len, stdin);
+        if (len < BUF_SIZE) buf[len] = '\0';
+    }
+
+    inline char peek() {
+        if (pos == len) refill();
+        return pos < len ? buf[pos] : '\0';
+    }
+
+    inline char skip() {  // skips whitespace, returns the first non-space char ('\0' on EOF)
+        char c;
+        while ((c = peek()) && c <= ' ') pos++;
+        return c;
+    }
+
+public:
+    template <std::integral T>
+    void read(T& x) {
+        skip();
+        if (len - pos < 64) refill();
+        bool neg = false;
+        if constexpr (std::is_signed_v<T>) {
+            if (buf[pos] == '-') neg = true, pos++;
+        }
+        std::make_unsigned_t<T> v = 0;
+        while (pos < len && (unsigned)(buf[pos] - '0') < 10) v = v * 10 + (buf[pos++] - '0');
+        x = neg ? -(T)v : (T)v;
+    }
+
+    void read(char& c) { if ((c = skip())) pos++; }
+
+    void read(std::string& s) {
+        s.clear();
+        for (char c = skip(); c > ' '; c = peek()) s.push_back(c), pos++;
+    }
+
+    void read(double& x) {
+        std::string s;
+        read(s);
+        x = std::stod(s);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); } && std::constructible_from<T, long long>
+    void read(T& x) {  // ModInt
+        long long v;
+        read(v);
+        x = T(v);
+    }
+
+    template <typename T, typename U>
+    void read(std::pair<T, U>& p) { read(p.first), read(p.second); }
+
+    template <typename T>
+    void read(std::vector<T>& v) { for (auto& x : v) read(x); }
+
+    template <typename T>
+    FastInput& operator>>(T& x) { read(x); return *this; }
+};
+
+struct FastOutput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0;
+
+    inline void reserve(int k) {
+        if (pos + k > BUF_SIZE) flush();
+    }
+
+public:
+    ~FastOutput() { flush(); }
+
+    void flush() {
+        std::fwrite(buf, 1, pos, stdout);
+        std::fflush(stdout);
+        pos = 0;
+    }
+
+    template <std::integral T>
+    void write(T x) {
+        reserve(40);
+        std::make_unsigned_t<T> v = x;
+        if constexpr (std::is_signed_v<T>) {
+            if (x < 0) buf[pos++] = '-', v = -v;
+        }
+        char tmp[40];
+        int k = 0;
+        do tmp[k++] = '0' + v % 10; while (v /= 10);
+        while (k) buf[pos++] = tmp[--k];
+    }
+
+    void write(char c) { reserve(1); buf[pos++] = c; }
+
+    void write(const char* s) { write(std::string_view(s)); }
+
+    void write(std::string_view s) {
+        for (size_t i = 0; i < s.size();) {
+            if (pos == BUF_SIZE) flush();
+            size_t k = std::min(s.size() - i, (size_t)(BUF_SIZE - pos));
+            std::memcpy(buf + pos, s.data() + i, k);
+            pos += k, i += k;
+        }
+    }
+
+    void write(double x) {
+        reserve(64);
+        pos += std::snprintf(buf + pos, 64, "%.15f", x);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); }
+    void write(T x) { write(x.value()); }  // ModInt
+
+    template <typename T, typename U>
+    void write(const std::pair<T, U>& p) { write(p.first), write(' '), write(p.second); }
+
+    template <typename T>
+    void write(const std::vector<T>& v) {
+        for (size_t i = 0; i < v.size(); i++) {
+            if (i) write(' ');
+            write(v[i]);
+        }
+    }
+
+    template <typename T>
+    FastOutput& operator<<(const T& x) { write(x); return *this; }
+};
+
+static FastInput in;
+static FastOutput out;
+
+
+int main() {
+    using mint = MontgomeryModInt<MOD2>;
+    using FPS = FormalPowerSeries<mint>;
+
+    // https://judge.yosupo.jp/problem/exp_of_formal_power_series
+    int N;
+    in >> N;
+    FPS a(N);
+    in >> a;
+    out << a.exp() << '\n';
+
+    // // https://judge.yosupo.jp/problem/inv_of_formal_power_series
+    // int N;
+    // in >> N;
+    // FPS a(N);
+    // in >> a;
+    // out << a.inv() << '\n';
+
+    // // https://judge.yosupo.jp/problem/log_of_formal_power_series
+    // int N;
+    // in >> N;
+    // FPS a(N);
+    // in >> a;
+    // out << a.log() << '\n';
+
+    // // https://judge.yosupo.jp/problem/pow_of_formal_power_series
+    // int N;
+    // long long M;
+    // in >> N >> M;
+    // FPS a(N);
+    // in >> a;
+    // out << a.pow(M) << '\n';
+
+    // // https://judge.yosupo.jp/problem/sqrt_of_formal_power_series
+    // int N;
+    // in >> N;
+    // FPS a(N);
+    // in >> a;
+    // FPS b = a.sqrt();
+    // if (b.empty()) out << -1 << '\n';
+    // else out << b << '\n';
+
+    return 0;
+}
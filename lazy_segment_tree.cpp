@@ -1,10 +1,18 @@
-#include <iostream>
 #include <concepts>
 #include <vector>
 #include <limits>
 #include <span>
+#include <bit>
 #include <numeric>
 #include <algorithm>
+#include <utility>
+#include <tuple>
+#include <thread>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
 
 template <typename F, typename S>
 concept BinaryOperation = requires(F f, S a, S b) {
@@ -16,45 +24,149 @@ concept MappingFunction = requires(G g, S data, E update) {
     { g(data, update) } -> std::convertible_to<S>;
 };
 
+// g(data, update, len): len is the number of leaves under the node (e.g. affine maps on sums)
+template <typename G, typename S, typename E>
+concept LengthMappingFunction = requires(G g, S data, E update, int len) {
+    { g(data, update, len) } -> std::convertible_to<S>;
+};
+
 template <typename H, typename E>
 concept CompositionFunction = requires(H h, E existing, E update) {
     { h(existing, update) } -> std::convertible_to<E>;
 };
 
-template <typename S, typename E, typename F, typename G, typename H>
+// storage of LazySegmentTree. Interleaved: a node's tag sits next to its value, so a push reads
+// each child from one line. DirtyBits: one bit per internal node marks a pending tag, so a clean
+// path tests a packed bitset instead of loading tags and comparing them with id
+template <bool Interleaved = false, bool DirtyBits = false>
+struct LazyLayout {
+    static constexpr bool interleaved = Interleaved, dirty_bits = DirtyBits;
+};
+using SplitLazy = LazyLayout<>;
+using InterleavedLazy = LazyLayout<true>;
+using DirtyBitLazy = LazyLayout<false, true>;
+
+template <typename S, typename E, typename F, typename G, typename H, typename Layout = SplitLazy>
 requires BinaryOperation<F, S> &&
-        MappingFunction<G, S, E> &&
+        (MappingFunction<G, S, E> || LengthMappingFunction<G, S, E>) &&
         CompositionFunction<H, E>
 class LazySegmentTree {
 private:
-    int n, size, log;
-    std::vector<S> data;
+    static constexpr int PARALLEL_BUILD = 1 << 17;  // leaves per thread below which build() stays serial
+
+    struct Node {
+        S val;
+        E lz;
+    };
+
+    int n, size, log, len;
+    std::vector<S> data;                    // !interleaved
     std::vector<E> lazy;
+    std::vector<Node> nodes;                // interleaved, leaves carry an unused tag
+    std::vector<unsigned long long> dirty;  // dirty_bits: bit k set iff internal node k has a pending tag
     F f;
     G g;
     H h;
     S e;
     E id;
 
+    inline S& dat(int k) {
+        if constexpr (Layout::interleaved) return nodes[k].val;
+        else return data[k];
+    }
+    inline const S& dat(int k) const {
+        if constexpr (Layout::interleaved) return nodes[k].val;
+        else return data[k];
+    }
+    inline E& tag(int k) {
+        if constexpr (Layout::interleaved) return nodes[k].lz;
+        else return lazy[k];
+    }
+    inline const E& tag(int k) const {
+        if constexpr (Layout::interleaved) return nodes[k].lz;
+        else return lazy[k];
+    }
+
+    inline bool pending(int k) const {
+        if constexpr (Layout::dirty_bits) return dirty[k >> 6] >> (k & 63) & 1;
+        else return !(tag(k) == id);
+    }
+
     inline void update_node(int k) {
-        data[k] = f(data[k << 1], data[(k << 1) | 1]);
+        dat(k) = f(dat(k << 1), dat((k << 1) | 1));
+    }
+
+    // node k sits at depth bit_width(k) - 1 and covers size >> depth leaves, so length-aware
+    // mappings need no per-node length array
+    inline S map_leaves(const S& v, const E& x, int w) const {  // w: leaves under the node
+        if constexpr (LengthMappingFunction<G, S, E>) {
+            return g(v, x, w);
+        } else {
+            return g(v, x);
+        }
+    }
+    inline S map(int k, const S& v, const E& x) const {
+        return map_leaves(v, x, size >> (std::bit_width((unsigned)k) - 1));
     }
 
     inline void apply_node(int k, const E& x) {
-        data[k] = g(data[k], x);
-        if (k < size) lazy[k] = h(lazy[k], x);
+        dat(k) = map(k, dat(k), x);
+        if (k < size) {
+            tag(k) = h(tag(k), x);
+            if constexpr (Layout::dirty_bits) dirty[k >> 6] |= 1ULL << (k & 63);
+        }
     }
 
+    // apply_node on both children, fused: the tag is copied out once instead of being reloaded
+    // through a reference the child writes may alias, and the siblings share their length, the
+    // leaf check and the dirty word (2k and 2k + 1 are adjacent bits of one word)
     inline void push(int k) {
-        if (lazy[k] == id) return;
-        apply_node(k << 1, lazy[k]);
-        apply_node((k << 1) | 1, lazy[k]);
-        lazy[k] = id;
+        if (!pending(k)) return;
+        const E x = tag(k);
+        const int l = k << 1, r = l | 1, w = size >> std::bit_width((unsigned)k);
+        dat(l) = map_leaves(dat(l), x, w);
+        dat(r) = map_leaves(dat(r), x, w);
+        if (l < size) {
+            tag(l) = h(tag(l), x);
+            tag(r) = h(tag(r), x);
+            if constexpr (Layout::dirty_bits) dirty[l >> 6] |= 3ULL << (l & 63);
+        }
+        tag(k) = id;
+        if constexpr (Layout::dirty_bits) dirty[k >> 6] &= ~(1ULL << (k & 63));
+    }
+
+    // fold of [a, b) once the tags above both boundaries are pushed. data[0] is never a node and
+    // holds e, so the index is selected instead of branching on a & 1 / b & 1
+    S fold(int a, int b) const {
+        S vl = e, vr = e;
+        for (a += size, b += size; a < b; a = (a + 1) >> 1, b >>= 1) {
+            vl = f(vl, dat(a & -(a & 1)));
+            vr = f(dat((b - 1) & -(b & 1)), vr);
+        }
+        return f(vl, vr);
+    }
+
+    void push_all() {
+        if constexpr (Layout::dirty_bits) {  // top-down, 64 clean nodes skipped per word
+            for (int w = 0; w < (int)dirty.size(); w++) {
+                while (dirty[w]) push(w << 6 | std::countr_zero(dirty[w]));
+            }
+        } else {
+            for (int k = 1; k < size; k++) push(k);
+        }
+    }
+
+    template <typename P>
+    static void run_parallel(unsigned threads, P p) {  // p(t) for t = 0 .. threads - 1, t = 0 on the calling thread
+        std::vector<std::thread> pool;
+        for (unsigned t = 1; t < threads; t++) pool.emplace_back(p, t);
+        p(0);
+        for (auto& th : pool) th.join();
     }
 
 public:
     LazySegmentTree(int n_, F f_, G g_, H h_, S e_, E id_)
-        : f(f_), g(g_), h(h_), e(e_), id(id_) {
+        : len(n_), f(f_), g(g_), h(h_), e(e_), id(id_) {
         n = 1;
         log = 0;
         while (n < n_) {
@@ -62,8 +174,13 @@ public:
             log++;
         }
         size = n;
-        data.assign(n << 1, e);
-        lazy.assign(size, id);
+        if constexpr (Layout::interleaved) {
+            nodes.assign(n << 1, {e, id});
+        } else {
+            data.assign(n << 1, e);
+            lazy.assign(size, id);
+        }
+        if constexpr (Layout::dirty_bits) dirty.assign((size >> 6) + 1, 0);
     }
 
     S operator[](int i) {
@@ -71,7 +188,7 @@ public:
         for (int j = log; j >= 1; j--) {
             push(i >> j);
         }
-        return data[i];
+        return dat(i);
     }
 
     void update(int i, const S& x) {
@@ -79,15 +196,38 @@ public:
         for (int j = log; j >= 1; j--) {
             push(i >> j);
         }
-        data[i] = x;
+        dat(i) = x;
         while (i >>= 1) update_node(i);
     }
 
-    void build(std::span<const S> v = {}) {
-        for (int i = 0; i < (int)v.size(); i++) {
-            data[n + i] = v[i];
+    // threads > 1 builds disjoint subtrees in parallel, then the few levels above them serially;
+    // trees under PARALLEL_BUILD leaves per thread stay serial
+    void build(std::span<const S> v = {}, unsigned threads = 1) {
+        threads = std::min<long long>(threads, len / PARALLEL_BUILD);
+        if (threads <= 1) {
+            for (int i = 0; i < (int)v.size(); i++) {
+                dat(n + i) = v[i];
+            }
+            for (int i = n - 1; i > 0; i--) {
+                update_node(i);
+            }
+            return;
         }
-        for (int i = n - 1; i > 0; i--) {
+
+        const int m = v.size();
+        run_parallel(threads, [&](unsigned t) {
+            for (int i = (long long)m * t / threads; i < (long long)m * (t + 1) / threads; i++) dat(n + i) = v[i];
+        });
+        // depth d holds nodes [2^d, 2^(d+1)); children of [a, b) are [2a, 2b)
+        int top = 1;
+        while (top < (int)threads * 4) top <<= 1;
+        run_parallel(threads, [&](unsigned t) {
+            const int lo = top + top * t / threads, hi = top + top * (t + 1) / threads;
+            for (int k = log - __builtin_ctz(top) - 1; k >= 0; k--) {
+                for (int i = (hi << k) - 1; i >= (lo << k); i--) update_node(i);
+            }
+        });
+        for (int i = top - 1; i > 0; i--) {
             update_node(i);
         }
     }
@@ -126,14 +266,120 @@ public:
             if (((b >> i) << i) != b) push((b - 1) >> i);
         }
 
-        S vl = e, vr = e;
-        while (a < b) {
-            if (a & 1) vl = f(vl, data[a++]);
-            if (b & 1) vr = f(data[--b], vr);
-            a >>= 1;
-            b >>= 1;
+        return fold(a - size, b - size);
+    }
+
+    // out[j] = query(qs[j]) for every j. Queries are bucketed by their left end so consecutive ones
+    // share boundary paths, and the leaves of upcoming queries are prefetched. With threads > 1 (or
+    // a batch covering 1/16 of the leaves) every tag is pushed first, after which the reads are
+    // independent and run on contiguous chunks in parallel
+    void query_batch(std::span<const std::pair<int, int>> qs, std::span<S> out, unsigned threads = 1) {
+        constexpr int PREFETCH = 8;
+        struct Q { int l, r, j; };
+        const int k = qs.size();
+        int shift = 0;
+        while ((len >> shift) >= std::max(k, 1)) shift++;
+        std::vector<int> cnt((len >> shift) + 2);
+        for (auto& [l, r] : qs) cnt[(l >> shift) + 1]++;
+        for (int i = 1; i < (int)cnt.size(); i++) cnt[i] += cnt[i - 1];
+        std::vector<Q> sorted(k);
+        for (int j = 0; j < k; j++) sorted[cnt[qs[j].first >> shift]++] = {qs[j].first, qs[j].second, j};
+
+        threads = std::max(1u, std::min<unsigned>(threads, k / 1024 + 1));
+        const bool flat = threads > 1 || (long long)k * 16 >= len;
+        if (flat) push_all();
+        run_parallel(threads, [&](unsigned t) {
+            const int lo = (long long)k * t / threads, hi = (long long)k * (t + 1) / threads;
+            for (int j = lo; j < hi; j++) {
+                // kept inline: a helper made only of prefetches is dropped as side-effect free by GCC
+                if (j + PREFETCH < hi && sorted[j + PREFETCH].l < sorted[j + PREFETCH].r) {
+                    int l = sorted[j + PREFETCH].l + size, r = sorted[j + PREFETCH].r - 1 + size;
+                    for (int i = 0; i < 8; i++) {
+                        __builtin_prefetch(&dat(l >> i));
+                        __builtin_prefetch(&dat(r >> i));
+                    }
+                }
+                auto [l, r, i] = sorted[j];
+                out[i] = flat ? (l < r ? fold(l, r) : e) : query(l, r);
+            }
+        });
+    }
+
+    // update(l, r, x) for every (l, r, x) in order. Parents are recomputed once per batch, level by
+    // level, instead of once per update: data[k] = g(f(children), lazy[k]) holds even while tags are
+    // still pending, so pulls can wait until every tag has been placed
+    void update_batch(std::span<const std::tuple<int, int, E>> ups) {
+        std::vector<int> cur;
+        cur.reserve(ups.size() * 2);
+        for (auto& [l, r, x] : ups) {
+            if (l >= r) continue;
+            int a = l + size, b = r + size;
+            for (int i = log; i >= 1; i--) {
+                if (((a >> i) << i) != a) push(a >> i);
+                if (((b >> i) << i) != b) push((b - 1) >> i);
+            }
+            for (int p = a, q = b; p < q; p >>= 1, q >>= 1) {
+                if (p & 1) apply_node(p++, x);
+                if (q & 1) apply_node(--q, x);
+            }
+            cur.push_back(a >> 1);
+            cur.push_back((b - 1) >> 1);
         }
-        return f(vl, vr);
+        std::sort(cur.begin(), cur.end());
+        while (!cur.empty() && cur[0] != 0) {  // every entry is on one level, the root is 1
+            int m = 0;
+            for (int i : cur) {
+                if (m == 0 || cur[m - 1] != i) cur[m++] = i;
+            }
+            cur.resize(m);
+            for (int i : cur) dat(i) = map(i, f(dat(i << 1), dat((i << 1) | 1)), tag(i));
+            for (int& i : cur) i >>= 1;
+        }
+    }
+
+    // largest r with pred(query(l, r)); pred must be monotone and pred(e) true, O(log n)
+    template <typename P>
+    int max_right(int l, P pred) {
+        if (l == len) return len;
+        l += size;
+        for (int i = log; i >= 1; i--) push(l >> i);
+        S sm = e;
+        do {
+            while (~l & 1) l >>= 1;
+            if (!pred(f(sm, dat(l)))) {
+                while (l < size) {
+                    push(l);
+                    l <<= 1;
+                    if (pred(f(sm, dat(l)))) sm = f(sm, dat(l++));
+                }
+                return std::min(l - size, len);  // padding leaves are not e under length-aware maps
+            }
+            sm = f(sm, dat(l++));
+        } while ((l & -l) != l);
+        return len;
+    }
+
+    // smallest l with pred(query(l, r)); pred must be monotone and pred(e) true, O(log n)
+    template <typename P>
+    int min_left(int r, P pred) {
+        if (r == 0) return 0;
+        r += size;
+        for (int i = log; i >= 1; i--) push((r - 1) >> i);
+        S sm = e;
+        do {
+            r--;
+            while (r > 1 && (r & 1)) r >>= 1;
+            if (!pred(f(dat(r), sm))) {
+                while (r < size) {
+                    push(r);
+                    r = (r << 1) | 1;
+                    if (pred(f(dat(r), sm))) sm = f(dat(r--), sm);
+                }
+                return r + 1 - size;
+            }
+            sm = f(dat(r), sm);
+        } while ((r & -r) != r);
+        return 0;
     }
 };
 /*
@@ -150,16 +396,175 @@ public:
 
     LazySegmentTree<S, E, decltype(op), decltype(mapping), decltype(composition)>
         seg(n, op, mapping, composition, id, id_e);
+
+    // length-aware mapping: range affine, range sum
+    auto mapping = [](mint data, std::pair<mint, mint> update, int len) -> mint {
+        return update.first * data + update.second * mint(len);
+    };
+
+    // batches
+    std::vector<std::pair<int, int>> qs = {{l1, r1}, {l2, r2}};
+    std::vector<S> ans(qs.size());
+    seg.query_batch(qs, ans, std::thread::hardware_concurrency());
+    seg.update_batch(std::vector<std::tuple<int, int, E>>{{l1, r1, x}, {l2, r2, y}});
+
+    // storage variants, same interface
+    LazySegmentTree<S, E, decltype(op), decltype(mapping), decltype(composition), InterleavedLazy>
+        seg(n, op, mapping, composition, id, id_e);
+    LazySegmentTree<S, E, decltype(op), decltype(mapping), decltype(composition), DirtyBitLazy>
+        seg(n, op, mapping, composition, id, id_e);
 */
 
 
+struct FastInput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0, len = 0;
+
+    inline void refill() {
+        len -= pos;
+        std::memmove(buf, buf + pos, len);
+        pos = 0;
+        len += std::fread(buf + len, 1, BUF_SIZE - len, stdin);
+        if (len < BUF_SIZE) buf[len] = '\0';
+    }
+
+    inline char peek() {
+        if (pos == len) refill();
+        return pos < len ? buf[pos] : '\0';
+    }
+
+    inline char skip() {  // skips whitespace, returns the first non-space char ('\0' on EOF)
+        char c;
+        while ((c = peek()) && c <= ' ') pos++;
+        return c;
+    }
+
+public:
+    template <std::integral T>
+    void read(T& x) {
+        skip();
+        if (len - pos < 64) refill();
+        bool neg = false;
+        if constexpr (std::is_signed_v<T>) {
+            if (buf[pos] == '-') neg = true, pos++;
+        }
+        std::make_unsigned_t<T> v = 0;
+        while (pos < len && (unsigned)(buf[pos] - '0') < 10) v = v * 10 + (buf[pos++] - '0');
+        x = neg ? -(T)v : (T)v;
+    }
+
+    void read(char& c) { if ((c = skip())) pos++; }
+
+    void read(std::string& s) {
+        s.clear();
+        for (char c = skip(); c > ' '; c = peek()) s.push_back(c), pos++;
+    }
+
+    void read(double& x) {
+        std::string s;
+        read(s);
+        x = std::stod(s);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); } && std::constructible_from<T, long long>
+    void read(T& x) {  // ModInt
+        long long v;
+        read(v);
+        x = T(v);
+    }
+
+    template <typename T, typename U>
+    void read(std::pair<T, U>& p) { read(p.first), read(p.second); }
+
+    template <typename T>
+    void read(std::vector<T>& v) { for (auto& x : v) read(x); }
+
+    template <typename T>
+    FastInput& operator>>(T& x) { read(x); return *this; }
+};
+
+struct FastOutput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0;
+
+    inline void reserve(int k) {
+        if (pos + k > BUF_SIZE) flush();
+    }
+
+public:
+    ~FastOutput() { flush(); }
+
+    void flush() {
+        std::fwrite(buf, 1, pos, stdout);
+        std::fflush(stdout);
+        pos = 0;
+    }
+
+    template <std::integral T>
+    void write(T x) {
+        reserve(40);
+        std::make_unsigned_t<T> v = x;
+        if constexpr (std::is_signed_v<T>) {
+            if (x < 0) buf[pos++] = '-', v = -v;
+        }
+        char tmp[40];
+        int k = 0;
+        do tmp[k++] = '0' + v % 10; while (v /= 10);
+        while (k) buf[pos++] = tmp[--k];
+    }
+
+    void write(char c) { reserve(1); buf[pos++] = c; }
+
+    void write(const char* s) { write(std::string_view(s)); }
+
+    void write(std::string_view s) {
+        for (size_t i = 0; i < s.size();) {
+            if (pos == BUF_SIZE) flush();
+            size_t k = std::min(s.size() - i, (size_t)(BUF_SIZE - pos));
+            std::memcpy(buf + pos, s.data() + i, k);
+            pos += k, i += k;
+        }
+    }
+
+    void write(double x) {
+        reserve(64);
+        pos += std::snprintf(buf + pos, 64, "%.15f", x);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); }
+    void write(T x) { write(x.value()); }  // ModInt
+
+    template <typename T, typename U>
+    void write(const std::pair<T, U>& p) { write(p.first), write(' '), write(p.second); }
+
+    template <typename T>
+    void write(const std::vector<T>& v) {
+        for (size_t i = 0; i < v.size(); i++) {
+            if (i) write(' ');
+            write(v[i]);
+        }
+    }
+
+    template <typename T>
+    FastOutput& operator<<(const T& x) { write(x); return *this; }
+};
+
+static FastInput in;
+static FastOutput out;
+
 
 int main() {
     int h, w, n;
-    std::cin >> h >> w >> n;
+    in >> h >> w >> n;
     std::vector<int> r(n), c(n), l(n);
     for (int i = 0; i < n; i++) {
-        std::cin >> r[i] >> c[i] >> l[i];
+        in >> r[i] >> c[i] >> l[i];
         c[i]--;
     }
 
@@ -190,7 +595,7 @@ int main() {
     }
 
     for (int i = 0; i < n; i++) {
-        std::cout << ans[i] << std::endl;
+        out << ans[i] << '\n';
     }
 
     return 0;
@@ -1,24 +1,40 @@
-#include <iostream>
 #include <vector>
 #include <map>
 #include <unordered_map>
 #include <utility>
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <concepts>
+#include <type_traits>
 
-struct UnionFind {
+// bookkeeping policies for UnionFind, inherited as its base: the default keeps only the par array,
+// EdgeLog also records every merge for make_groups / group_edges / edge_cnt. Without EdgeLog,
+// edges and group_edges do not exist, so reading the log is a compile error.
+struct NoEdgeLog {
+    static constexpr bool log_edges = false;
+};
+struct EdgeLog {
+    static constexpr bool log_edges = true;
+    std::unordered_map<int, std::vector<std::pair<int, int>>> group_edges;
+    std::vector<std::pair<int, int>> edges;
+};
+
+template <typename Policy = NoEdgeLog>
+struct UnionFind : Policy {
 private:
-    std::vector<int> par;
+    std::vector<int> par;  // par[x] < 0: x is a root and -par[x] its group size
 
 public:
     std::unordered_map<int, std::vector<int>> groups;
-    std::unordered_map<int, std::vector<std::pair<int, int>>> group_edges;
-    std::vector<std::pair<int, int>> edges;
     bool has_cycle;
 
     UnionFind(const int n_) : par(n_, -1), has_cycle(false) {}
 
     bool merge(const int x, const int y) {
-        edges.emplace_back(x, y);
+        if constexpr (Policy::log_edges) this->edges.emplace_back(x, y);
         int root_x = root(x);
         int root_y = root(y);
         if (root_x == root_y) {
@@ -35,9 +51,13 @@ public:
         return merge(p.first, p.second);
     }
 
-    int root(int x) {
-        if (par[x] < 0) return x;
-        return par[x] = root(par[x]);
+    int root(int x) {  // iterative path halving: every other node on the path skips to its grandparent
+        while (par[x] >= 0) {
+            const int p = par[x];
+            if (par[p] < 0) return p;
+            x = par[x] = par[p];
+        }
+        return x;
     }
 
     bool issame(const int x, const int y) {
@@ -48,30 +68,175 @@ public:
         return -par[root(x)];
     }
 
-    int edge_cnt(const int x) {
-        const auto it = group_edges.find(root(x));
-        return it != group_edges.end() ? it->second.size() : 0;
+    int edge_cnt(const int x) requires Policy::log_edges {
+        const auto it = this->group_edges.find(root(x));
+        return it != this->group_edges.end() ? it->second.size() : 0;
     }
 
     void make_groups() {
         for (int i = 0; i < static_cast<int>(par.size()); i++) {
             groups[root(i)].push_back(i);
         }
-        for (const auto& p : edges) {
-            group_edges[root(p.first)].push_back(p);
+        if constexpr (Policy::log_edges) {
+            for (const auto& p : this->edges) {
+                this->group_edges[root(p.first)].push_back(p);
+            }
+        }
+    }
+};
+
+struct FastInput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0, len = 0;
+
+    inline void refill() {
+        len -= pos;
+        std::memmove(buf, buf + pos, len);
+        pos = 0;
+        len += std::fread(buf + len, 1, BUF_SIZE - len, stdin);
+        if (len < BUF_SIZE) buf[len] = '\0';
+    }
+
+    inline char peek() {
+        if (pos == len) refill();
+        return pos < len ? buf[pos] : '\0';
+    }
+
+    inline char skip() {  // skips whitespace, returns the first non-space char ('\0' on EOF)
+        char c;
+        while ((c = peek()) && c <= ' ') pos++;
+        return c;
+    }
+
+public:
+    template <std::integral T>
+    void read(T& x) {
+        skip();
+        if (len - pos < 64) refill();
+        bool neg = false;
+        if constexpr (std::is_signed_v<T>) {
+            if (buf[pos] == '-') neg = true, pos++;
+        }
+        std::make_unsigned_t<T> v = 0;
+        while (pos < len && (unsigned)(buf[pos] - '0') < 10) v = v * 10 + (buf[pos++] - '0');
+        x = neg ? -(T)v : (T)v;
+    }
+
+    void read(char& c) { if ((c = skip())) pos++; }
+
+    void read(std::string& s) {
+        s.clear();
+        for (char c = skip(); c > ' '; c = peek()) s.push_back(c), pos++;
+    }
+
+    void read(double& x) {
+        std::string s;
+        read(s);
+        x = std::stod(s);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); } && std::constructible_from<T, long long>
+    void read(T& x) {  // ModInt
+        long long v;
+        read(v);
+        x = T(v);
+    }
+
+    template <typename T, typename U>
+    void read(std::pair<T, U>& p) { read(p.first), read(p.second); }
+
+    template <typename T>
+    void read(std::vector<T>& v) { for (auto& x : v) read(x); }
+
+    template <typename T>
+    FastInput& operator>>(T& x) { read(x); return *this; }
+};
+
+struct FastOutput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0;
+
+    inline void reserve(int k) {
+        if (pos + k > BUF_SIZE) flush();
+    }
+
+public:
+    ~FastOutput() { flush(); }
+
+    void flush() {
+        std::fwrite(buf, 1, pos, stdout);
+        std::fflush(stdout);
+        pos = 0;
+    }
+
+    template <std::integral T>
+    void write(T x) {
+        reserve(40);
+        std::make_unsigned_t<T> v = x;
+        if constexpr (std::is_signed_v<T>) {
+            if (x < 0) buf[pos++] = '-', v = -v;
+        }
+        char tmp[40];
+        int k = 0;
+        do tmp[k++] = '0' + v % 10; while (v /= 10);
+        while (k) buf[pos++] = tmp[--k];
+    }
+
+    void write(char c) { reserve(1); buf[pos++] = c; }
+
+    void write(const char* s) { write(std::string_view(s)); }
+
+    void write(std::string_view s) {
+        for (size_t i = 0; i < s.size();) {
+            if (pos == BUF_SIZE) flush();
+            size_t k = std::min(s.size() - i, (size_t)(BUF_SIZE - pos));
+            std::memcpy(buf + pos, s.data() + i, k);
+            pos += k, i += k;
+        }
+    }
+
+    void write(double x) {
+        reserve(64);
+        pos += std::snprintf(buf + pos, 64, "%.15f", x);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); }
+    void write(T x) { write(x.value()); }  // ModInt
+
+    template <typename T, typename U>
+    void write(const std::pair<T, U>& p) { write(p.first), write(' '), write(p.second); }
+
+    template <typename T>
+    void write(const std::vector<T>& v) {
+        for (size_t i = 0; i < v.size(); i++) {
+            if (i) write(' ');
+            write(v[i]);
         }
     }
+
+    template <typename T>
+    FastOutput& operator<<(const T& x) { write(x); return *this; }
 };
 
+static FastInput in;
+static FastOutput out;
+
+
 int main() {
     int N, M;
-    std::cin >> N >> M;
+    in >> N >> M;
 
     std::vector<std::tuple<long long, int, int, int>> edges(M);
     for (int i = 0; i < M; ++i) {
         int a, b;
         long long c;
-        std::cin >> a >> b >> c;
+        in >> a >> b >> c;
         edges[i] = {c, a, b, i};
     }
 
@@ -92,12 +257,12 @@ int main() {
         }
     }
 
-    std::cout << total_weight << std::endl;
+    out << total_weight << '\n';
     for (int i = 0; i < selected_edges.size(); ++i) {
-        std::cout << selected_edges[i];
-        if (i < selected_edges.size() - 1) std::cout << " ";
+        out << selected_edges[i];
+        if (i < selected_edges.size() - 1) out << " ";
     }
-    std::cout << std::endl;
+    out << '\n';
 
     return 0;
 }
@@ -7,6 +7,11 @@
 #include <algorithm>
 #include <utility>
 #include <random>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
 
 template <typename F, typename S>
 concept BinaryOperation = requires(F f, S a, S b) {
@@ -163,88 +168,248 @@ public:
 constexpr int MOD1 = 1000000007;
 constexpr int MOD2 = 998244353;
 
-template <const int& mod>
-struct ModInt {
+template <int mod>
+struct MontgomeryModInt {  // odd compile-time modulus < 2^30, same interface as ModInt
+	static_assert(mod & 1 && mod < (1 << 30));
+
 private:
-	int x;
+	using u32 = unsigned int;
+	using u64 = unsigned long long;
+
+	static constexpr u32 get_r() {  // -mod^{-1} mod 2^32
+		u32 inv = mod;
+		for (int i = 0; i < 4; i++) inv *= 2 - mod * inv;
+		return -inv;
+	}
+	static constexpr u32 neg_inv = get_r();
+	static constexpr u32 n2 = -u64(mod) % mod;  // 2^64 mod mod
+
+	static constexpr u32 reduce(u64 b) {  // b * 2^-32 mod mod, result in [0, 2 * mod)
+		return (b + u64(u32(b) * neg_inv) * mod) >> 32;
+	}
+
+	u32 x;  // x * 2^32 mod mod, kept in [0, mod)
 
 public:
-	ModInt() : x(0) {}
-	ModInt(long long x_) { if ((x = x_ % mod + mod) >= mod) x -= mod; }
-
-	constexpr ModInt& operator+=(ModInt rhs) { if ((x += rhs.x) >= mod) x -= mod; return *this; }
-	constexpr ModInt& operator-=(ModInt rhs) { if ((x -= rhs.x) < 0) x += mod; return *this; }
-	constexpr ModInt& operator*=(ModInt rhs) { x = (unsigned long long)x * rhs.x % mod; return *this; }
-	constexpr ModInt& operator/=(ModInt rhs) { x = (unsigned long long)x * rhs.inv().x % mod; return *this; }
-
-	constexpr ModInt operator-() const noexcept { return -x < 0 ? mod - x : -x; }
-	constexpr ModInt operator+(ModInt rhs) const noexcept { return ModInt(*this) += rhs; }
-	constexpr ModInt operator-(ModInt rhs) const noexcept { return ModInt(*this) -= rhs; }
-	constexpr ModInt operator*(ModInt rhs) const noexcept { return ModInt(*this) *= rhs; }
-	constexpr ModInt operator/(ModInt rhs) const noexcept { return ModInt(*this) /= rhs; }
-
-	constexpr ModInt& operator++() { *this += 1; return *this; }
-	constexpr ModInt operator++(int) { *this += 1; return *this - 1; }
-	constexpr ModInt& operator--() { *this -= 1; return *this; }
-	constexpr ModInt operator--(int) { *this -= 1; return *this + 1; }
-
-	bool operator==(ModInt rhs) const { return x == rhs.x; }
-	bool operator!=(ModInt rhs) const { return x != rhs.x; }
-	bool operator<=(ModInt rhs) const { return x <= rhs.x; }
-	bool operator>=(ModInt rhs) const { return x >= rhs.x; }
-	bool operator<(ModInt rhs) const { return x < rhs.x; }
-	bool operator>(ModInt rhs) const { return x > rhs.x; }
-
-    friend std::istream& operator>>(std::istream& s, ModInt<mod>& a) { s >> a.x; return s; }
-    friend std::ostream& operator<<(std::ostream& s, ModInt<mod> a) { s << a.x; return s; }
-
-	int value() {
-		return this->x;
+	MontgomeryModInt() : x(0) {}
+	MontgomeryModInt(long long x_) : x(reduce(u64(x_ % mod + mod) * n2)) { if (x >= mod) x -= mod; }
+
+	constexpr MontgomeryModInt& operator+=(MontgomeryModInt rhs) { if ((x += rhs.x) >= mod) x -= mod; return *this; }
+	constexpr MontgomeryModInt& operator-=(MontgomeryModInt rhs) { if ((x += mod - rhs.x) >= mod) x -= mod; return *this; }
+	constexpr MontgomeryModInt& operator*=(MontgomeryModInt rhs) { if ((x = reduce(u64(x) * rhs.x)) >= mod) x -= mod; return *this; }
+	constexpr MontgomeryModInt& operator/=(MontgomeryModInt rhs) { return *this *= rhs.inv(); }
+
+	constexpr MontgomeryModInt operator-() const noexcept { return MontgomeryModInt() - *this; }
+	constexpr MontgomeryModInt operator+(MontgomeryModInt rhs) const noexcept { return MontgomeryModInt(*this) += rhs; }
+	constexpr MontgomeryModInt operator-(MontgomeryModInt rhs) const noexcept { return MontgomeryModInt(*this) -= rhs; }
+	constexpr MontgomeryModInt operator*(MontgomeryModInt rhs) const noexcept { return MontgomeryModInt(*this) *= rhs; }
+	constexpr MontgomeryModInt operator/(MontgomeryModInt rhs) const noexcept { return MontgomeryModInt(*this) /= rhs; }
+
+	constexpr MontgomeryModInt& operator++() { *this += 1; return *this; }
+	constexpr MontgomeryModInt operator++(int) { *this += 1; return *this - 1; }
+	constexpr MontgomeryModInt& operator--() { *this -= 1; return *this; }
+	constexpr MontgomeryModInt operator--(int) { *this -= 1; return *this + 1; }
+
+	bool operator==(MontgomeryModInt rhs) const { return x == rhs.x; }
+	bool operator!=(MontgomeryModInt rhs) const { return x != rhs.x; }
+	bool operator<=(MontgomeryModInt rhs) const { return value() <= rhs.value(); }
+	bool operator>=(MontgomeryModInt rhs) const { return value() >= rhs.value(); }
+	bool operator<(MontgomeryModInt rhs) const { return value() < rhs.value(); }
+	bool operator>(MontgomeryModInt rhs) const { return value() > rhs.value(); }
+
+	friend std::istream& operator>>(std::istream& s, MontgomeryModInt& a) { long long v; s >> v; a = v; return s; }
+	friend std::ostream& operator<<(std::ostream& s, MontgomeryModInt a) { s << a.value(); return s; }
+
+	int value() const {
+		u32 v = reduce(x);
+		return v >= mod ? v - mod : v;
 	}
 
-    ModInt inv() {
-		int a = x, b = mod, u = 1, v = 0, t;
+	MontgomeryModInt inv() const {
+		int a = value(), b = mod, u = 1, v = 0, t;
 		while (b > 0) { t = a / b, std::swap(a -= t * b, b), std::swap(u -= t * v, v); }
-		return ModInt(u);
+		return MontgomeryModInt(u);
 	}
 
-    ModInt pow(long long n) const {
-		ModInt ret(1), mul(x);
+	MontgomeryModInt pow(long long n) const {
+		MontgomeryModInt ret(1), mul(*this);
 		while (n > 0) { if (n & 1) ret *= mul; mul *= mul; n >>= 1; }
 		return ret;
 	}
 
 	int sqrt() const {
-		if (x <= 1) return x;
+		if (value() <= 1) return value();
 		if (pow((mod - 1) / 2) != 1) return -1;
 
 		int q = mod - 1, m = 0;
-        std::mt19937 mt;
-		ModInt z = mt();
+		std::mt19937 mt;
+		MontgomeryModInt z = mt();
 
 		while (~q & 1) q >>= 1, m++;
 		while (z.pow((mod - 1) / 2) != mod - 1) z = mt();
 
-		ModInt c = z.pow(q);
-		ModInt t = pow(q);
-		ModInt r = pow((q + 1) / 2);
+		MontgomeryModInt c = z.pow(q);
+		MontgomeryModInt t = pow(q);
+		MontgomeryModInt r = pow((q + 1) / 2);
 
 		for (; m > 1; m--) {
-			ModInt tmp = t.pow(1 << (m - 2));
-            if (tmp != 1) r = r * c, t = t * c * c;
+			MontgomeryModInt tmp = t.pow(1 << (m - 2));
+			if (tmp != 1) r = r * c, t = t * c * c;
 			c = c * c;
 		}
 
-		return std::min(r.x, mod - r.x);
+		return std::min(r.value(), mod - r.value());
 	}
 };
 
-static int MOD = MOD2;
-using mint = ModInt<MOD>;
+using mint = MontgomeryModInt<MOD2>;
+
+struct FastInput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0, len = 0;
+
+    inline void refill() {
+        len -= pos;
+        std::memmove(buf, buf + pos, len);
+        pos = 0;
+        len += std::fread(buf + len, 1, BUF_SIZE - len, stdin);
+        if (len < BUF_SIZE) buf[len] = '\0';
+    }
+
+    inline char peek() {
+        if (pos == len) refill();
+        return pos < len ? buf[pos] : '\0';
+    }
+
+    inline char skip() {  // skips whitespace, returns the first non-space char ('\0' on EOF)
+        char c;
+        while ((c = peek()) && c <= ' ') pos++;
+        return c;
+    }
+
+public:
+    template <std::integral T>
+    void read(T& x) {
+        skip();
+        if (len - pos < 64) refill();
+        bool neg = false;
+        if constexpr (std::is_signed_v<T>) {
+            if (buf[pos] == '-') neg = true, pos++;
+        }
+        std::make_unsigned_t<T> v = 0;
+        while (pos < len && (unsigned)(buf[pos] - '0') < 10) v = v * 10 + (buf[pos++] - '0');
+        x = neg ? -(T)v : (T)v;
+    }
+
+    void read(char& c) { if ((c = skip())) pos++; }
+
+    void read(std::string& s) {
+        s.clear();
+        for (char c = skip(); c > ' '; c = peek()) s.push_back(c), pos++;
+    }
+
+    void read(double& x) {
+        std::string s;
+        read(s);
+        x = std::stod(s);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); } && std::constructible_from<T, long long>
+    void read(T& x) {  // ModInt
+        long long v;
+        read(v);
+        x = T(v);
+    }
+
+    template <typename T, typename U>
+    void read(std::pair<T, U>& p) { read(p.first), read(p.second); }
+
+    template <typename T>
+    void read(std::vector<T>& v) { for (auto& x : v) read(x); }
+
+    template <typename T>
+    FastInput& operator>>(T& x) { read(x); return *this; }
+};
+
+struct FastOutput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0;
+
+    inline void reserve(int k) {
+        if (pos + k > BUF_SIZE) flush();
+    }
+
+public:
+    ~FastOutput() { flush(); }
+
+    void flush() {
+        std::fwrite(buf, 1, pos, stdout);
+        std::fflush(stdout);
+        pos = 0;
+    }
+
+    template <std::integral T>
+    void write(T x) {
+        reserve(40);
+        std::make_unsigned_t<T> v = x;
+        if constexpr (std::is_signed_v<T>) {
+            if (x < 0) buf[pos++] = '-', v = -v;
+        }
+        char tmp[40];
+        int k = 0;
+        do tmp[k++] = '0' + v % 10; while (v /= 10);
+        while (k) buf[pos++] = tmp[--k];
+    }
+
+    void write(char c) { reserve(1); buf[pos++] = c; }
+
+    void write(const char* s) { write(std::string_view(s)); }
+
+    void write(std::string_view s) {
+        for (size_t i = 0; i < s.size();) {
+            if (pos == BUF_SIZE) flush();
+            size_t k = std::min(s.size() - i, (size_t)(BUF_SIZE - pos));
+            std::memcpy(buf + pos, s.data() + i, k);
+            pos += k, i += k;
+        }
+    }
+
+    void write(double x) {
+        reserve(64);
+        pos += std::snprintf(buf + pos, 64, "%.15f", x);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); }
+    void write(T x) { write(x.value()); }  // ModInt
+
+    template <typename T, typename U>
+    void write(const std::pair<T, U>& p) { write(p.first), write(' '), write(p.second); }
+
+    template <typename T>
+    void write(const std::vector<T>& v) {
+        for (size_t i = 0; i < v.size(); i++) {
+            if (i) write(' ');
+            write(v[i]);
+        }
+    }
+
+    template <typename T>
+    FastOutput& operator<<(const T& x) { write(x); return *this; }
+};
+
+static FastInput in;
+static FastOutput out;
+
 
 int main() {
     int N, Q;
-    std::cin >> N >> Q;
+    in >> N >> Q;
 
     using S = mint;
     using E = std::pair<mint, mint>;
@@ -268,22 +433,22 @@ int main() {
         seg(N, op, mapping, composition, id, id_e);
 
     std::vector<mint> A(N);
-    for (mint& x : A) std::cin >> x;
+    for (mint& x : A) in >> x;
 
     seg.build(A);
 
     while (Q--) {
         int t;
-        std::cin >> t;
+        in >> t;
         if (t == 0) {
             int l, r;
             mint b, c;
-            std::cin >> l >> r >> b >> c;
+            in >> l >> r >> b >> c;
             seg.update(l, r, std::make_pair(b, c));
         } else {
             int i;
-            std::cin >> i;
-            std::cout << seg[i] << std::endl;
+            in >> i;
+            out << seg[i] << '\n';
         }
     }
 
@@ -1,75 +1,260 @@
-#include <iostream>
 #include <concepts>
 #include <vector>
 #include <span>
+#include <bit>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <utility>
+#include <type_traits>
 
-template<typename T, typename F>
-concept BinaryOperation = requires(F f, T a, T b) {
-    { f(a, b) } -> std::same_as<T>;
+template <typename F, typename S>
+concept BinaryOperation = requires(F f, S a, S b) {
+    { f(a, b) } -> std::convertible_to<S>;
 };
 
-template<typename T, typename F>
-requires BinaryOperation<T, F>
-class SegmentTree {
+// f must be associative and idempotent (f(x, x) == x): min, max, gcd, and, or, ...
+template <typename S, typename F>
+requires BinaryOperation<F, S>
+class SparseTable {
 private:
     int n;
-    std::vector<T> data;
+    std::vector<std::vector<S>> table;  // table[k][i] = f over [i, i + 2^k)
     F f;
-    T e;
 
 public:
-    SegmentTree(int n_, F f_, T e_) : n(1), f(std::move(f_)), e(std::move(e_)) {
-        while (n < n_) n <<= 1;
-        data.assign(n << 1, e);
+    SparseTable(std::span<const S> v, F f_) : n(v.size()), f(f_) {
+        table.emplace_back(v.begin(), v.end());
+        for (int k = 1; (1 << k) <= n; k++) {
+            const std::vector<S>& prev = table.back();
+            std::vector<S> cur(n - (1 << k) + 1);
+            for (int i = 0; i + (1 << k) <= n; i++) cur[i] = f(prev[i], prev[i + (1 << (k - 1))]);
+            table.push_back(std::move(cur));
+        }
+    }
+
+    S query(int a, int b) const {  // [a, b), a < b
+        const int k = std::bit_width((unsigned int)(b - a)) - 1;
+        return f(table[k][a], table[k][b - (1 << k)]);
     }
+};
 
-    T operator[](int i) const { return data[n + i]; }
+// O(n) words: sparse table over blocks of 64, in-block queries by a suffix-winner bitmask per position.
+// f must be a selection (f(x, y) is x or y): min, max, or an arg-min on pairs
+template <typename S, typename F>
+requires BinaryOperation<F, S>
+class StaticRMQ {
+private:
+    static constexpr int B = 64;
+    int n;
+    std::vector<S> data;
+    std::vector<uint64_t> mask;  // bit j of mask[i]: data[block(i) + j] wins over everything in (block(i) + j, i]
+    SparseTable<S, F> blocks;
+    F f;
 
-    void update(int i, const T& x) {
-        data[i += n] = x;
-        while (i >>= 1) data[i] = f(data[(i << 1) | 0], data[(i << 1) | 1]);
+    static std::vector<S> block_values(std::span<const S> v, F f) {
+        std::vector<S> r((v.size() + B - 1) / B);
+        for (size_t i = 0; i < v.size(); i++) r[i / B] = i % B ? f(r[i / B], v[i]) : v[i];
+        return r;
     }
 
-    void build(std::span<const T> v = {}) {
-        for (size_t i = 0; i < v.size(); i++) data[n + i] = v[i];
-        for (int i = n - 1; i > 0; i--) data[i] = f(data[(i << 1) | 0], data[(i << 1) | 1]);
+    S in_block(int a, int b) const {  // [a, b] inside one block
+        return data[(b & -B) + std::countr_zero(mask[b] >> (a & (B - 1)) << (a & (B - 1)))];
     }
 
-    T query(int a, int b) const {  // [a, b)
-        if (a >= b) return e;
-        T vl = e, vr = e;
-        for (int l = a + n, r = b + n; l < r; l >>= 1, r >>= 1) {
-            if (l & 1) vl = f(vl, data[l++]);
-            if (r & 1) vr = f(data[--r], vr);
+public:
+    StaticRMQ(std::span<const S> v, F f_)
+        : n(v.size()), data(v.begin(), v.end()), mask(n), blocks(block_values(v, f_), f_), f(f_) {
+        for (int s = 0; s < n; s += B) {
+            uint64_t cur = 0;
+            for (int i = s; i < std::min(n, s + B); i++) {
+                // drop every candidate that data[i] beats, latest first
+                while (cur) {
+                    const int j = s + std::bit_width(cur) - 1;
+                    if (f(data[j], data[i]) == data[j]) break;
+                    cur ^= 1ULL << (j - s);
+                }
+                mask[i] = cur |= 1ULL << (i - s);
+            }
         }
-        return f(vl, vr);
+    }
+
+    S query(int a, int b) const {  // [a, b), a < b
+        b--;
+        const int ba = a / B, bb = b / B;
+        if (ba == bb) return in_block(a, b);
+        S res = f(in_block(a, ba * B + B - 1), in_block(bb * B, b));
+        if (ba + 1 < bb) res = f(res, blocks.query(ba + 1, bb));
+        return res;
     }
 };
 /*
     // example
-    using T = int;
-    auto f = [](T x1, T x2) { return std::max(x1, x2); };
-    const T ex = std::numeric_limits<T>::min();
-    SegmentTree<T, decltype(f)> seg(n, f, ex);
+    auto op = [](int a, int b) { return std::min(a, b); };
+    SparseTable<int, decltype(op)> st(A, op);  // any idempotent op, O(n log n) words
+    StaticRMQ<int, decltype(op)> rmq(A, op);   // selection ops only, O(n) words
 */
 
+struct FastInput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0, len = 0;
+
+    inline void refill() {
+        len -= pos;
+        std::memmove(buf, buf + pos, len);
+        pos = 0;
+        len += std::fread(buf + len, 1, BUF_SIZE - len, stdin);
+        if (len < BUF_SIZE) buf[len] = '\0';
+    }
+
+    inline char peek() {
+        if (pos == len) refill();
+        return pos < len ? buf[pos] : '\0';
+    }
+
+    inline char skip() {  // skips whitespace, returns the first non-space char ('\0' on EOF)
+        char c;
+        while ((c = peek()) && c <= ' ') pos++;
+        return c;
+    }
+
+public:
+    template <std::integral T>
+    void read(T& x) {
+        skip();
+        if (len - pos < 64) refill();
+        bool neg = false;
+        if constexpr (std::is_signed_v<T>) {
+            if (buf[pos] == '-') neg = true, pos++;
+        }
+        std::make_unsigned_t<T> v = 0;
+        while (pos < len && (unsigned)(buf[pos] - '0') < 10) v = v * 10 + (buf[pos++] - '0');
+        x = neg ? -(T)v : (T)v;
+    }
+
+    void read(char& c) { if ((c = skip())) pos++; }
+
+    void read(std::string& s) {
+        s.clear();
+        for (char c = skip(); c > ' '; c = peek()) s.push_back(c), pos++;
+    }
+
+    void read(double& x) {
+        std::string s;
+        read(s);
+        x = std::stod(s);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); } && std::constructible_from<T, long long>
+    void read(T& x) {  // ModInt
+        long long v;
+        read(v);
+        x = T(v);
+    }
+
+    template <typename T, typename U>
+    void read(std::pair<T, U>& p) { read(p.first), read(p.second); }
+
+    template <typename T>
+    void read(std::vector<T>& v) { for (auto& x : v) read(x); }
+
+    template <typename T>
+    FastInput& operator>>(T& x) { read(x); return *this; }
+};
+
+struct FastOutput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0;
+
+    inline void reserve(int k) {
+        if (pos + k > BUF_SIZE) flush();
+    }
+
+public:
+    ~FastOutput() { flush(); }
+
+    void flush() {
+        std::fwrite(buf, 1, pos, stdout);
+        std::fflush(stdout);
+        pos = 0;
+    }
+
+    template <std::integral T>
+    void write(T x) {
+        reserve(40);
+        std::make_unsigned_t<T> v = x;
+        if constexpr (std::is_signed_v<T>) {
+            if (x < 0) buf[pos++] = '-', v = -v;
+        }
+        char tmp[40];
+        int k = 0;
+        do tmp[k++] = '0' + v % 10; while (v /= 10);
+        while (k) buf[pos++] = tmp[--k];
+    }
+
+    void write(char c) { reserve(1); buf[pos++] = c; }
+
+    void write(const char* s) { write(std::string_view(s)); }
+
+    void write(std::string_view s) {
+        for (size_t i = 0; i < s.size();) {
+            if (pos == BUF_SIZE) flush();
+            size_t k = std::min(s.size() - i, (size_t)(BUF_SIZE - pos));
+            std::memcpy(buf + pos, s.data() + i, k);
+            pos += k, i += k;
+        }
+    }
+
+    void write(double x) {
+        reserve(64);
+        pos += std::snprintf(buf + pos, 64, "%.15f", x);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); }
+    void write(T x) { write(x.value()); }  // ModInt
+
+    template <typename T, typename U>
+    void write(const std::pair<T, U>& p) { write(p.first), write(' '), write(p.second); }
+
+    template <typename T>
+    void write(const std::vector<T>& v) {
+        for (size_t i = 0; i < v.size(); i++) {
+            if (i) write(' ');
+            write(v[i]);
+        }
+    }
+
+    template <typename T>
+    FastOutput& operator<<(const T& x) { write(x); return *this; }
+};
+
+static FastInput in;
+static FastOutput out;
+
+
 int main() {
     int N, Q;
-    std::cin >> N >> Q;
+    in >> N >> Q;
 
     std::vector<int> A(N);
-    for (int& a : A) std::cin >> a;
+    for (int& a : A) in >> a;
 
     auto f = [](int x1, int x2) { return std::min(x1, x2); };
-    const int ex = std::numeric_limits<int>::max();
-    SegmentTree<int, decltype(f)> seg(N, f, ex);
-
-    seg.build(A);
+    StaticRMQ<int, decltype(f)> rmq(A, f);
 
     while (Q--) {
         int l, r;
-        std::cin >> l >> r;
-        std::cout << seg.query(l, r) << std::endl;
+        in >> l >> r;
+        out << rmq.query(l, r) << '\n';
     }
     return 0;
 }
@@ -0,0 +1,502 @@
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <random>
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cassert>
+#include <type_traits>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <concepts>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+constexpr int MOD1 = 1000000007;
+constexpr int MOD2 = 998244353;
+
+template <int mod>
+struct MontgomeryModInt {  // odd compile-time modulus < 2^30, same interface as ModInt
+	static_assert(mod & 1 && mod < (1 << 30));
+
+private:
+	using u32 = unsigned int;
+	using u64 = unsigned long long;
+
+	static constexpr u32 get_r() {  // -mod^{-1} mod 2^32
+		u32 inv = mod;
+		for (int i = 0; i < 4; i++) inv *= 2 - mod * inv;
+		return -inv;
+	}
+	static constexpr u32 neg_inv = get_r();
+	static constexpr u32 n2 = -u64(mod) % mod;  // 2^64 mod mod
+
+	static constexpr u32 reduce(u64 b) {  // b * 2^-32 mod mod, result in [0, 2 * mod)
+		return (b + u64(u32(b) * neg_inv) * mod) >> 32;
+	}
+
+	u32 x;  // x * 2^32 mod mod, kept in [0, mod)
+
+public:
+	MontgomeryModInt() : x(0) {}
+	MontgomeryModInt(long long x_) : x(reduce(u64(x_ % mod + mod) * n2)) { if (x >= mod) x -= mod; }
+
+	constexpr MontgomeryModInt& operator+=(MontgomeryModInt rhs) { if ((x += rhs.x) >= mod) x -= mod; return *this; }
+	constexpr MontgomeryModInt& operator-=(MontgomeryModInt rhs) { if ((x += mod - rhs.x) >= mod) x -= mod; return *this; }
+	constexpr MontgomeryModInt& operator*=(MontgomeryModInt rhs) { if ((x = reduce(u64(x) * rhs.x)) >= mod) x -= mod; return *this; }
+	constexpr MontgomeryModInt& operator/=(MontgomeryModInt rhs) { return *this *= rhs.inv(); }
+
+	constexpr MontgomeryModInt operator-() const noexcept { return MontgomeryModInt() - *this; }
+	constexpr MontgomeryModInt operator+(MontgomeryModInt rhs) const noexcept { return MontgomeryModInt(*this) += rhs; }
+	constexpr MontgomeryModInt operator-(MontgomeryModInt rhs) const noexcept { return MontgomeryModInt(*this) -= rhs; }
+	constexpr MontgomeryModInt operator*(MontgomeryModInt rhs) const noexcept { return MontgomeryModInt(*this) *= rhs; }
+	constexpr MontgomeryModInt operator/(MontgomeryModInt rhs) const noexcept { return MontgomeryModInt(*this) /= rhs; }
+
+	constexpr MontgomeryModInt& operator++() { *this += 1; return *this; }
+	constexpr MontgomeryModInt operator++(int) { *this += 1; return *this - 1; }
+	constexpr MontgomeryModInt& operator--() { *this -= 1; return *this; }
+	constexpr MontgomeryModInt operator--(int) { *this -= 1; return *this + 1; }
+
+	bool operator==(MontgomeryModInt rhs) const { return x == rhs.x; }
+	bool operator!=(MontgomeryModInt rhs) const { return x != rhs.x; }
+	bool operator<=(MontgomeryModInt rhs) const { return value() <= rhs.value(); }
+	bool operator>=(MontgomeryModInt rhs) const { return value() >= rhs.value(); }
+	bool operator<(MontgomeryModInt rhs) const { return value() < rhs.value(); }
+	bool operator>(MontgomeryModInt rhs) const { return value() > rhs.value(); }
+
+	friend std::istream& operator>>(std::istream& s, MontgomeryModInt& a) { long long v; s >> v; a = v; return s; }
+	friend std::ostream& operator<<(std::ostream& s, MontgomeryModInt a) { s << a.value(); return s; }
+
+	int value() const {
+		u32 v = reduce(x);
+		return v >= mod ? v - mod : v;
+	}
+
+	MontgomeryModInt inv() const {
+		int a = value(), b = mod, u = 1, v = 0, t;
+		while (b > 0) { t = a / b, std::swap(a -= t * b, b), std::swap(u -= t * v, v); }
+		return MontgomeryModInt(u);
+	}
+
+	MontgomeryModInt pow(long long n) const {
+		MontgomeryModInt ret(1), mul(*this);
+		while (n > 0) { if (n & 1) ret *= mul; mul *= mul; n >>= 1; }
+		return ret;
+	}
+
+	int sqrt() const {
+		if (value() <= 1) return value();
+		if (pow((mod - 1) / 2) != 1) return -1;
+
+		int q = mod - 1, m = 0;
+		std::mt19937 mt;
+		MontgomeryModInt z = mt();
+
+		while (~q & 1) q >>= 1, m++;
+		while (z.pow((mod - 1) / 2) != mod - 1) z = mt();
+
+		MontgomeryModInt c = z.pow(q);
+		MontgomeryModInt t = pow(q);
+		MontgomeryModInt r = pow((q + 1) / 2);
+
+		for (; m > 1; m--) {
+			MontgomeryModInt tmp = t.pow(1 << (m - 2));
+			if (tmp != 1) r = r * c, t = t * c * c;
+			c = c * c;
+		}
+
+		return std::min(r.value(), mod - r.value());
+	}
+};
+
+// 8-lane AVX2 NTT over 32-bit Montgomery residues (the raw representation of MontgomeryModInt).
+// The vector kernels are used when compiled with -mavx2 / -march=native, otherwise the scalar ones.
+template <int mod>
+struct SimdNTT {
+    using mint = MontgomeryModInt<mod>;
+    using u32 = unsigned int;
+    using u64 = unsigned long long;
+    static_assert(sizeof(mint) == sizeof(u32) && std::is_trivially_copyable_v<mint>);
+    static constexpr int rank2 = std::countr_zero((unsigned int)(mod - 1));  // max transform size is 2^rank2
+
+#ifdef __AVX2__
+    static constexpr bool has_avx2 = true;
+#else
+    static constexpr bool has_avx2 = false;
+#endif
+
+private:
+    static constexpr u32 get_neg_inv() {  // -mod^{-1} mod 2^32
+        u32 inv = mod;
+        for (int i = 0; i < 4; i++) inv *= 2 - mod * inv;
+        return -inv;
+    }
+    static constexpr u32 neg_inv = get_neg_inv();
+
+    static int primitive_root() {
+        for (int g = 2;; g++) {
+            bool ok = true;
+            for (int p = 2, x = mod - 1; p <= x && ok; p++) {
+                if (x % p) continue;
+                ok = mint(g).pow((mod - 1) / p) != 1;
+                while (x % p == 0) x /= p;
+            }
+            if (ok) return g;
+        }
+    }
+
+    // w[len + j] = (2len-th root)^j in Montgomery form
+    static inline std::vector<u32> w{0, 0}, iw{0, 0};
+
+    static void prepare(int n) {
+        if (w.size() == 2) w[1] = iw[1] = std::bit_cast<u32>(mint(1));
+        if ((int)w.size() >= n) return;
+        assert(std::countr_zero((unsigned int)n) <= rank2);
+        static const int g = primitive_root();
+        for (int len = w.size(); len < n; len <<= 1) {
+            mint r = mint(g).pow((mod - 1) / (len << 1)), ir = r.inv(), x = 1, y = 1;
+            w.resize(len << 1), iw.resize(len << 1);
+            for (int j = 0; j < len; j++, x *= r, y *= ir) w[len + j] = std::bit_cast<u32>(x), iw[len + j] = std::bit_cast<u32>(y);
+        }
+    }
+
+    static u32 add(u32 a, u32 b) { a += b; return std::min(a, a - mod); }
+    static u32 sub(u32 a, u32 b) { a += mod - b; return std::min(a, a - mod); }
+    static u32 mul(u32 a, u32 b) {
+        u64 t = u64(a) * b;
+        u32 r = (t + u64(u32(t) * neg_inv) * mod) >> 32;
+        return std::min(r, r - mod);
+    }
+
+#ifdef __AVX2__
+    static __m256i add(__m256i a, __m256i b) {
+        __m256i s = _mm256_add_epi32(a, b);
+        return _mm256_min_epu32(s, _mm256_sub_epi32(s, _mm256_set1_epi32(mod)));
+    }
+    static __m256i sub(__m256i a, __m256i b) {
+        __m256i d = _mm256_add_epi32(_mm256_sub_epi32(a, b), _mm256_set1_epi32(mod));
+        return _mm256_min_epu32(d, _mm256_sub_epi32(d, _mm256_set1_epi32(mod)));
+    }
+    static __m256i mul(__m256i a, __m256i b) {  // even and odd lanes go through separate 32x32->64 products
+        const __m256i m = _mm256_set1_epi32(mod), ni = _mm256_set1_epi32(neg_inv);
+        __m256i pe = _mm256_mul_epu32(a, b);
+        __m256i po = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+        __m256i re = _mm256_add_epi64(pe, _mm256_mul_epu32(_mm256_mul_epu32(pe, ni), m));
+        __m256i ro = _mm256_add_epi64(po, _mm256_mul_epu32(_mm256_mul_epu32(po, ni), m));
+        __m256i r = _mm256_blend_epi32(_mm256_srli_epi64(re, 32), ro, 0b10101010);
+        return _mm256_min_epu32(r, _mm256_sub_epi32(r, m));
+    }
+    static __m256i load(const u32* p) { return _mm256_loadu_si256((const __m256i*)p); }
+    static void store(u32* p, __m256i x) { _mm256_storeu_si256((__m256i*)p, x); }
+#endif
+
+public:
+    // natural order in, bit-reversed order out
+    template <bool simd = has_avx2>
+    static void transform(u32* a, int n) {
+        prepare(n);
+        for (int len = n >> 1; len >= 1; len >>= 1) {
+            const u32* t = w.data() + len;
+            for (int i = 0; i < n; i += len << 1) {
+                u32* p = a + i;
+                u32* q = p + len;
+                int j = 0;
+#ifdef __AVX2__
+                if constexpr (simd) {
+                    for (; j + 8 <= len; j += 8) {
+                        __m256i u = load(p + j), v = load(q + j);
+                        store(p + j, add(u, v));
+                        store(q + j, mul(sub(u, v), load(t + j)));
+                    }
+                }
+#endif
+                for (; j < len; j++) {
+                    u32 u = p[j], v = q[j];
+                    p[j] = add(u, v);
+                    q[j] = mul(sub(u, v), t[j]);
+                }
+            }
+        }
+    }
+
+    // bit-reversed order in, natural order out, scaled by 1/n
+    template <bool simd = has_avx2>
+    static void inverse_transform(u32* a, int n) {
+        prepare(n);
+        for (int len = 1; len < n; len <<= 1) {
+            const u32* t = iw.data() + len;
+            for (int i = 0; i < n; i += len << 1) {
+                u32* p = a + i;
+                u32* q = p + len;
+                int j = 0;
+#ifdef __AVX2__
+                if constexpr (simd) {
+                    for (; j + 8 <= len; j += 8) {
+                        __m256i u = load(p + j), v = mul(load(q + j), load(t + j));
+                        store(p + j, add(u, v));
+                        store(q + j, sub(u, v));
+                    }
+                }
+#endif
+                for (; j < len; j++) {
+                    u32 u = p[j], v = mul(q[j], t[j]);
+                    p[j] = add(u, v);
+                    q[j] = sub(u, v);
+                }
+            }
+        }
+        pointwise_mul<simd>(a, n, std::bit_cast<u32>(mint(n).inv()));
+    }
+
+    template <bool simd = has_avx2>
+    static void pointwise_mul(u32* a, const u32* b, int n) {
+        int i = 0;
+#ifdef __AVX2__
+        if constexpr (simd) {
+            for (; i + 8 <= n; i += 8) store(a + i, mul(load(a + i), load(b + i)));
+        }
+#endif
+        for (; i < n; i++) a[i] = mul(a[i], b[i]);
+    }
+
+    template <bool simd = has_avx2>
+    static void pointwise_mul(u32* a, int n, u32 c) {
+        int i = 0;
+#ifdef __AVX2__
+        if constexpr (simd) {
+            const __m256i cv = _mm256_set1_epi32(c);
+            for (; i + 8 <= n; i += 8) store(a + i, mul(load(a + i), cv));
+        }
+#endif
+        for (; i < n; i++) a[i] = mul(a[i], c);
+    }
+
+    // ModInt boundary: MontgomeryModInt already stores x * 2^32 mod mod, so this is a plain copy
+    static std::vector<u32> to_raw(const std::vector<mint>& a, int n) {
+        std::vector<u32> r(n);
+        for (int i = 0; i < std::min<int>(n, a.size()); i++) r[i] = std::bit_cast<u32>(a[i]);
+        return r;
+    }
+
+    static std::vector<mint> from_raw(const std::vector<u32>& r, int n) {
+        std::vector<mint> a(n);
+        for (int i = 0; i < n; i++) a[i] = std::bit_cast<mint>(r[i]);
+        return a;
+    }
+
+    template <bool simd = has_avx2>
+    static std::vector<mint> convolution(const std::vector<mint>& a, const std::vector<mint>& b) {
+        const int n = a.size(), m = b.size();
+        if (!n || !m) return {};
+        const int sz = std::bit_ceil((unsigned int)(n + m - 1));
+        assert(std::countr_zero((unsigned int)sz) <= rank2);
+        std::vector<u32> x = to_raw(a, sz), y = to_raw(b, sz);
+        transform<simd>(x.data(), sz);
+        transform<simd>(y.data(), sz);
+        pointwise_mul<simd>(x.data(), y.data(), sz);
+        inverse_transform<simd>(x.data(), sz);
+        return from_raw(x, n + m - 1);
+    }
+};
+/*
+    // example (compile with -mavx2 or -march=native to enable the vector kernels)
+    using mint = MontgomeryModInt<MOD2>;
+    std::vector<mint> c = SimdNTT<MOD2>::convolution(a, b);
+    std::vector<mint> d = SimdNTT<MOD2>::convolution<false>(a, b);  // force scalar kernels
+*/
+
+
+void benchmark() {
+    using mint = MontgomeryModInt<MOD2>;
+    using NTT = SimdNTT<MOD2>;
+    std::mt19937 rng(1);
+    std::printf("%6s %14s %14s %8s\n", "n", "scalar [ms]", "simd [ms]", "speedup");
+    for (int lg = 10; lg <= 23; lg++) {
+        const int n = 1 << lg;
+        std::vector<mint> a(n);
+        for (mint& x : a) x = rng();
+        std::vector<unsigned int> x = NTT::to_raw(a, n), y = x;
+
+        // transform + inverse round trip, repeated until at least ~0.2 s of work
+        const int reps = std::max(1, (1 << 22) / n);
+        auto run = [&]<bool simd>(std::vector<unsigned int>& v) {
+            auto st = std::chrono::steady_clock::now();
+            for (int k = 0; k < reps; k++) {
+                NTT::transform<simd>(v.data(), n);
+                NTT::inverse_transform<simd>(v.data(), n);
+            }
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - st).count() / reps;
+        };
+        double ts = run.template operator()<false>(x);
+        double tv = run.template operator()<true>(y);
+        assert(x == y && NTT::from_raw(x, n) == a);
+        std::printf("%6s %14.3f %14.3f %8.2f\n", ("2^" + std::to_string(lg)).c_str(), ts, tv, ts / tv);
+    }
+}
+
+
+struct FastInput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0, len = 0;
+
+    inline void refill() {
+        len -= pos;
+        std::memmove(buf, buf + pos, len);
+        pos = 0;
+        len += std::fread(buf + len, 1, BUF_SIZE - len, stdin);
+        if (len < BUF_SIZE) buf[len] = '\0';
+    }
+
+    inline char peek() {
+        if (pos == len) refill();
+        return pos < len ? buf[pos] : '\0';
+    }
+
+    inline char skip() {  // skips whitespace, returns the first non-space char ('\0' on EOF)
+        char c;
+        while ((c = peek()) && c <= ' ') pos++;
+        return c;
+    }
+
+public:
+    template <std::integral T>
+    void read(T& x) {
+        skip();
+        if (len - pos < 64) refill();
+        bool neg = false;
+        if constexpr (std::is_signed_v<T>) {
+            if (buf[pos] == '-') neg = true, pos++;
+        }
+        std::make_unsigned_t<T> v = 0;
+        while (pos < len && (unsigned)(buf[pos] - '0') < 10) v = v * 10 + (buf[pos++] - '0');
+        x = neg ? -(T)v : (T)v;
+    }
+
+    void read(char& c) { if ((c = skip())) pos++; }
+
+    void read(std::string& s) {
+        s.clear();
+        for (char c = skip(); c > ' '; c = peek()) s.push_back(c), pos++;
+    }
+
+    void read(double& x) {
+        std::string s;
+        read(s);
+        x = std::stod(s);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); } && std::constructible_from<T, long long>
+    void read(T& x) {  // ModInt
+        long long v;
+        read(v);
+        x = T(v);
+    }
+
+    template <typename T, typename U>
+    void read(std::pair<T, U>& p) { read(p.first), read(p.second); }
+
+    template <typename T>
+    void read(std::vector<T>& v) { for (auto& x : v) read(x); }
+
+    template <typename T>
+    FastInput& operator>>(T& x) { read(x); return *this; }
+};
+
+struct FastOutput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0;
+
+    inline void reserve(int k) {
+        if (pos + k > BUF_SIZE) flush();
+    }
+
+public:
+    ~FastOutput() { flush(); }
+
+    void flush() {
+        std::fwrite(buf, 1, pos, stdout);
+        std::fflush(stdout);
+        pos = 0;
+    }
+
+    template <std::integral T>
+    void write(T x) {
+        reserve(40);
+        std::make_unsigned_t<T> v = x;
+        if constexpr (std::is_signed_v<T>) {
+            if (x < 0) buf[pos++] = '-', v = -v;
+        }
+        char tmp[40];
+        int k = 0;
+        do tmp[k++] = '0' + v % 10; while (v /= 10);
+        while (k) buf[pos++] = tmp[--k];
+    }
+
+    void write(char c) { reserve(1); buf[pos++] = c; }
+
+    void write(const char* s) { write(std::string_view(s)); }
+
+    void write(std::string_view s) {
+        for (size_t i = 0; i < s.size();) {
+            if (pos == BUF_SIZE) flush();
+            size_t k = std::min(s.size() - i, (size_t)(BUF_SIZE - pos));
+            std::memcpy(buf + pos, s.data() + i, k);
+            pos += k, i += k;
+        }
+    }
+
+    void write(double x) {
+        reserve(64);
+        pos += std::snprintf(buf + pos, 64, "%.15f", x);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); }
+    void write(T x) { write(x.value()); }  // ModInt
+
+    template <typename T, typename U>
+    void write(const std::pair<T, U>& p) { write(p.first), write(' '), write(p.second); }
+
+    template <typename T>
+    void write(const std::vector<T>& v) {
+        for (size_t i = 0; i < v.size(); i++) {
+            if (i) write(' ');
+            write(v[i]);
+        }
+    }
+
+    template <typename T>
+    FastOutput& operator<<(const T& x) { write(x); return *this; }
+};
+
+static FastInput in;
+static FastOutput out;
+
+
+// https://judge.yosupo.jp/problem/convolution_mod
+int main(int argc, char** argv) {
+    if (argc > 1 && std::string_view(argv[1]) == "bench") {
+        benchmark();
+        return 0;
+    }
+
+    int N, M;
+    in >> N >> M;
+
+    using mint = MontgomeryModInt<MOD2>;
+    std::vector<mint> a(N), b(M);
+    in >> a >> b;
+
+    out << SimdNTT<MOD2>::convolution(a, b) << '\n';
+
+    return 0;
+}
@@ -1,5 +1,3 @@
-#include <iostream>
-#include <map>
 #include <random>
 #include <chrono>
 #include <vector>
@@ -7,6 +5,42 @@
 #include <concepts>
 #include <ranges>
 #include <bit>
+#include <array>
+#include <span>
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <thread>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+struct Montgomery64 {  // arithmetic modulo an odd n < 2^64, values in Montgomery form x * 2^64 mod n
+    uint64_t n, n_inv, r2;
+
+    Montgomery64() = default;
+    explicit Montgomery64(uint64_t n_) : n(n_), n_inv(n_), r2(-__uint128_t(n_) % n_) {
+        for (int i = 0; i < 5; i++) n_inv *= 2 - n * n_inv;  // n^{-1} mod 2^64
+    }
+
+    uint64_t reduce(__uint128_t t) const {  // t * 2^-64 mod n for t < n * 2^64, no overflow even for n near 2^64
+        uint64_t hi = t >> 64, mn = (__uint128_t)((uint64_t)t * n_inv) * n >> 64;
+        return hi >= mn ? hi - mn : hi - mn + n;
+    }
+
+    uint64_t mul(uint64_t a, uint64_t b) const { return reduce((__uint128_t)a * b); }
+    uint64_t to(uint64_t x) const { return mul(x % n, r2); }
+    uint64_t from(uint64_t x) const { return reduce(x); }
+    uint64_t one() const { return to(1); }
+
+    uint64_t pow(uint64_t a, uint64_t e) const {  // a in Montgomery form
+        uint64_t r = one();
+        for (; e; e >>= 1, a = mul(a, a)) if (e & 1) r = mul(r, a);
+        return r;
+    }
+};
 
 template<std::unsigned_integral T>
 struct NumTheory {
@@ -25,90 +59,210 @@ private:
         return result;
     }
 
-    bool check_composite(T n, T a, T d, int s) {
-        T x = binpower(a, d, n);
-        if (x == 1 || x == n - 1)
-            return false;
-        for (int r = 1; r < s; r++) {
-            x = (__uint128_t)x * x % n;
-            if (x == n - 1)
-                return false;
-        }
-        return true;
+    // deterministic Miller-Rabin bases: 3 suffice below 2^32, 7 below 2^64
+    static constexpr std::array<uint64_t, 3> bases32 = {2, 7, 61};
+    static constexpr std::array<uint64_t, 7> bases64 = {2, 325, 9375, 28178, 450775, 9780504, 1795265022};
+
+    static int trivial_primality(T n) {  // 1 / 0 if decided by small divisors, -1 if Miller-Rabin is needed
+        if (n < 64) return (0x28208a20a08a28acULL >> n) & 1;
+        if (n % 2 == 0 || n % 3 == 0 || n % 5 == 0 || n % 7 == 0) return 0;
+        return -1;
     }
 
-    T pollard_rho(T n, int max_iterations = 1'000'000) {
-        if (n % 2 == 0)
-            return 2;
-
-        auto dist = std::uniform_int_distribution<T>{2, n - 1};
-        T x = dist(rng);
-        T y = x;
-        T c = dist(rng);
-        T d = 1;
-
-        for (int i = 0; i < max_iterations && d == 1; ++i) {
-            x = ((__uint128_t)x * x + c) % n;
-            y = ((__uint128_t)y * y + c) % n;
-            y = ((__uint128_t)y * y + c) % n;
-            d = std::gcd(std::abs((long long)x - (long long)y), (long long)n);
+    // Brent's cycle finding in Montgomery form; |x - y| is multiplied into q and gcd'd once per block
+    // (a Montgomery factor 2^64 is coprime to odd n, so it does not change the gcd)
+    T pollard_rho(T n) {
+        if (n % 2 == 0) return 2;
+        constexpr int block = 128;
+        const Montgomery64 mg(n);
+        auto dist = std::uniform_int_distribution<uint64_t>{1, (uint64_t)n - 1};
+        auto diff = [](uint64_t a, uint64_t b) { return a > b ? a - b : b - a; };
+
+        while (true) {
+            const uint64_t c = mg.to(dist(rng));
+            auto f = [&](uint64_t x) {
+                x = mg.mul(x, x);
+                return x >= n - c ? x - (n - c) : x + c;
+            };
+            uint64_t x = 0, y = mg.to(dist(rng)), ys = y, q = mg.one();
+            uint64_t g = 1;
+            for (uint64_t r = 1; g == 1; r <<= 1) {
+                x = y;
+                for (uint64_t i = 0; i < r; i++) y = f(y);
+                for (uint64_t k = 0; k < r && g == 1; k += block) {
+                    ys = y;
+                    for (uint64_t i = 0; i < std::min<uint64_t>(block, r - k); i++) {
+                        y = f(y);
+                        q = mg.mul(q, diff(x, y));
+                    }
+                    g = std::gcd(q, (uint64_t)n);
+                }
+            }
+            if (g == n) {  // the block overshot, replay it one step at a time
+                do {
+                    ys = f(ys);
+                    g = std::gcd(diff(x, ys), (uint64_t)n);
+                } while (g == 1);
+            }
+            if (g != n) return g;
         }
-
-        return d;
     }
 
-    T trial_division(T n) const {
-        for (T i = 2; i * i <= n; ++i) {
-            if (n % i == 0) return i;
+    struct SmallPrime { uint64_t p, inv, lim; };  // n % p == 0 iff n * inv <= lim (mod 2^64)
+
+    static constexpr auto small_primes = [] {
+        std::array<SmallPrime, 53> t{};  // odd primes below 256
+        int k = 0;
+        for (uint64_t p = 3; p < 256; p += 2) {
+            bool prime = true;
+            for (uint64_t q = 3; q * q <= p; q += 2) prime &= p % q != 0;
+            if (!prime) continue;
+            uint64_t inv = p;
+            for (int i = 0; i < 5; i++) inv *= 2 - p * inv;
+            t[k++] = {p, inv, ~0ULL / p};
         }
-        return n;
+        return t;
+    }();
+
+    static constexpr uint64_t PARALLEL_MIN_WORK = 1 << 16;
+
+    template <typename F>
+    static void run_parallel(unsigned threads, F f) {  // f(t) for t = 0 .. threads - 1, t = 0 on the calling thread
+        std::vector<std::thread> pool;
+        for (unsigned t = 1; t < threads; t++) pool.emplace_back(f, t);
+        f(0);
+        for (auto& th : pool) th.join();
     }
 
 public:
     NumTheory() : rng(std::chrono::steady_clock::now().time_since_epoch().count()) {}
 
     bool is_prime(T n) {
-        if (n < 2)
-            return false;
-        if (n < 4)
+        if (int r = trivial_primality(n); r != -1) return r;
+
+        const Montgomery64 mg(n);
+        const int s = std::countr_zero((uint64_t)n - 1);
+        const uint64_t d = ((uint64_t)n - 1) >> s, one = mg.one(), minus_one = n - one;
+
+        auto composite = [&](uint64_t a) {
+            if ((a %= n) == 0) return false;
+            uint64_t x = mg.pow(mg.to(a), d);
+            if (x == one || x == minus_one) return false;
+            for (int r = 1; r < s; r++) {
+                if ((x = mg.mul(x, x)) == minus_one) return false;
+            }
             return true;
-        if (n % 2 == 0 || n % 3 == 0)
-            return false;
-
-        int r = std::countr_zero(n - 1);
-        T d = (n - 1) >> r;
-
-        constexpr std::array witnesses = {2ULL, 3ULL, 5ULL, 7ULL, 11ULL, 13ULL, 17ULL, 19ULL, 23ULL, 29ULL, 31ULL, 37ULL};
-        for (T a : witnesses | std::views::take_while([n](T x) { return x < n; })) {
-            if (check_composite(n, a, d, r))
-                return false;
-        }
-        return true;
+        };
+        if ((uint64_t)n < (1ULL << 32)) return std::ranges::none_of(bases32, composite);
+        return std::ranges::none_of(bases64, composite);
     }
 
-    std::map<T, T> factorize(T n) {
-        std::map<T, T> factors;
-
-        for (T i = 2; i * i <= n && i <= 1'000'000; ++i) {
-            while (n % i == 0) {
-                factors[i]++;
-                n /= i;
-            }
+    // same answers as is_prime, but K numbers run Miller-Rabin in lockstep so that K independent
+    // Montgomery multiplications are in flight instead of one dependent chain; a lane that finishes
+    // its number (composite witness found or all bases passed) picks up the next pending one
+    std::vector<bool> is_prime_many(std::span<const T> ns) {
+        constexpr int K = 8;
+        std::vector<bool> res(ns.size());
+        std::vector<size_t> pending;
+        for (size_t i = 0; i < ns.size(); i++) {
+            int r = trivial_primality(ns[i]);
+            if (r == -1) pending.push_back(i);
+            else res[i] = r;
         }
 
-        while (n > 1) {
-            if (is_prime(n)) {
-                factors[n]++;
-                break;
+        Montgomery64 mg[K];
+        uint64_t d[K], one[K], minus_one[K];
+        const uint64_t* bases[K];
+        int s[K], base_cnt[K], base_i[K];
+        size_t id[K], next = 0;
+        int active = 0;
+
+        auto load = [&](int l) {
+            id[l] = next < pending.size() ? pending[next++] : ns.size();
+            const uint64_t n = id[l] < ns.size() ? (uint64_t)ns[id[l]] : 3;  // idle lanes spin on n = 3
+            mg[l] = Montgomery64(n);
+            s[l] = std::countr_zero(n - 1);
+            d[l] = (n - 1) >> s[l];
+            one[l] = mg[l].one(), minus_one[l] = n - one[l];
+            if (n < (1ULL << 32)) bases[l] = bases32.data(), base_cnt[l] = bases32.size();
+            else bases[l] = bases64.data(), base_cnt[l] = bases64.size();
+            base_i[l] = 0;
+            active += id[l] < ns.size();
+        };
+        for (int l = 0; l < K; l++) load(l);
+
+        while (active) {
+            uint64_t x[K], y[K];
+            bool ok[K];
+            int bits = 0, rounds = 0;
+            for (int l = 0; l < K; l++) {
+                const uint64_t a = bases[l][base_i[l]];
+                ok[l] = a % mg[l].n == 0;
+                x[l] = one[l], y[l] = mg[l].to(a);
+                bits = std::max(bits, (int)std::bit_width(d[l]));
             }
-            T factor = pollard_rho(n);
-            if (factor == n) {
-                factor = trial_division(n);
+            for (int i = 0; i < bits; i++) {
+                for (int l = 0; l < K; l++) {
+                    const uint64_t z = mg[l].mul(x[l], y[l]);
+                    x[l] = (d[l] >> i & 1) ? z : x[l];
+                    y[l] = mg[l].mul(y[l], y[l]);
+                }
+            }
+            for (int l = 0; l < K; l++) {
+                ok[l] |= x[l] == one[l] || x[l] == minus_one[l];
+                if (!ok[l]) rounds = std::max(rounds, s[l] - 1);
+            }
+            for (int r = 1; r <= rounds; r++) {
+                for (int l = 0; l < K; l++) {
+                    if (ok[l] || r >= s[l]) continue;
+                    x[l] = mg[l].mul(x[l], x[l]);
+                    ok[l] = x[l] == minus_one[l];
+                }
+            }
+            for (int l = 0; l < K; l++) {
+                if (id[l] == ns.size()) continue;
+                if (ok[l] && ++base_i[l] < base_cnt[l]) continue;
+                res[id[l]] = ok[l];
+                active--;
+                load(l);
             }
-            factors[factor]++;
-            n /= factor;
         }
+        return res;
+    }
 
+    // (prime, exponent) pairs in increasing order of prime
+    std::vector<std::pair<T, int>> factorize(T n) {
+        std::vector<std::pair<T, int>> factors;
+        if (n <= 1) return factors;
+
+        uint64_t m = n;
+        if (int e = std::countr_zero(m)) factors.emplace_back(2, e), m >>= e;
+        for (const auto& [p, inv, lim] : small_primes) {
+            if (p * p > m) break;
+            if (m * inv > lim) continue;
+            int e = 0;
+            while (m * inv <= lim) m *= inv, e++;
+            factors.emplace_back(p, e);
+        }
+        if (m == 1) return factors;
+
+        std::vector<T> primes, stack{(T)m};
+        while (!stack.empty()) {
+            T x = stack.back();
+            stack.pop_back();
+            if (x < 256 * 256 || is_prime(x)) {
+                primes.push_back(x);
+                continue;
+            }
+            T d = pollard_rho(x);
+            stack.push_back(d);
+            stack.push_back(x / d);
+        }
+        std::sort(primes.begin(), primes.end());
+        for (size_t i = 0; i < primes.size(); i++) {
+            if (i && primes[i] == primes[i - 1]) factors.back().second++;
+            else factors.emplace_back(primes[i], 1);
+        }
         return factors;
     }
 
@@ -122,12 +276,16 @@ public:
         return static_cast<T>(result);
     }
 
-    T count_primes(T n) {
+    // pi(n); the per-prime update of larges and the final correction loop are split across threads
+    // once the arrays are large enough to amortize spawning them
+    T count_primes(T n, unsigned threads = std::max(1u, std::thread::hardware_concurrency())) {
         if (n <= 1) return 0;
         if (n == 2) return 1;
         const T sq = std::sqrt(n);
         T s = (1 + sq) >> 1;
-        std::vector<T> smalls(s), roughs(s), larges(s);
+        // indices and half-counts are below sqrt(n) / 2, so only larges needs the full width of T
+        std::vector<uint32_t> smalls(s), roughs(s);
+        std::vector<T> larges(s), next;
 
         for (T i = 0; i < s; i++) {
             if (i) smalls[i] = i;
@@ -138,6 +296,7 @@ public:
         std::vector<bool> skip(sq + 1);
         const auto divide = [](T n, T d) -> T { return static_cast<T>((long double)n / d); };
         const auto half = [](T n) -> T { return (n - 1) >> 1; };
+        const auto use_threads = [&](T work) { return threads > 1 && work >= PARALLEL_MIN_WORK; };
 
         T pc = 0;
         for (T p = 3; p <= sq; p += 2) {
@@ -146,13 +305,32 @@ public:
             if (q * q > n) break;
             skip[p] = true;
             for (T i = q; i <= sq; i += p << 1) skip[i] = true;
+
+            // new larges[k] for a surviving rough number roughs[k]; reads only indices >= k
+            const auto updated = [&](T k) -> T {
+                T d = roughs[k] * p;
+                return larges[k] - (d <= sq ? larges[smalls[d >> 1] - pc] : smalls[half(divide(n, d))]) + pc;
+            };
             T ns = 0;
-            for (T k = 0; k < s; k++) {
-                T i = roughs[k];
-                if (skip[i]) continue;
-                T d = i * p;
-                larges[ns] = larges[k] - (d <= sq ? larges[smalls[d >> 1] - pc] : smalls[half(divide(n, d))]) + pc;
-                roughs[ns++] = i;
+            if (use_threads(s)) {  // compute into a side buffer so that no thread overwrites what another still reads
+                next.resize(s);
+                run_parallel(threads, [&](unsigned t) {
+                    const T lo = s * t / threads, hi = s * (t + 1) / threads;
+                    for (T k = lo; k < hi; k++) {
+                        if (!skip[roughs[k]]) next[k] = updated(k);
+                    }
+                });
+                for (T k = 0; k < s; k++) {
+                    if (skip[roughs[k]]) continue;
+                    larges[ns] = next[k];
+                    roughs[ns++] = roughs[k];
+                }
+            } else {
+                for (T k = 0; k < s; k++) {
+                    if (skip[roughs[k]]) continue;
+                    larges[ns] = updated(k);
+                    roughs[ns++] = roughs[k];
+                }
             }
             s = ns;
             for (T i = half(sq), j = ((sq / p) - 1) | 1; j >= p; j -= 2) {
@@ -161,16 +339,28 @@ public:
             }
             pc++;
         }
+        next = {};
 
         larges[0] += (s + 2 * (pc - 1)) * (s - 1) / 2;
         for (T k = 1; k < s; k++) larges[0] -= larges[k];
-        for (T l = 1; l < s; l++) {
-            T q = roughs[l]; T m = n / q;
-            T e = smalls[half(m / q)] - pc;
-            if (e < l + 1) break;
-            T t = 0;
+
+        // contributions of l = 1 .. last - 1, where e(l) = pi(n / q^2) - pc only shrinks as l grows
+        const auto bound = [&](T l) -> T { T q = roughs[l]; return smalls[half(n / q / q)] - pc; };
+        T last = 1;
+        while (last < s && bound(last) >= last + 1) last++;
+        const auto correction = [&](T l) -> T {
+            T q = roughs[l], m = n / q, e = bound(l), t = 0;
             for (T k = l + 1; k <= e; k++) t += smalls[half(divide(m, roughs[k]))];
-            larges[0] += t - (e - l) * (pc + l - 1);
+            return t - (e - l) * (pc + l - 1);
+        };
+        if (use_threads(last)) {
+            std::vector<T> part(threads);
+            run_parallel(threads, [&](unsigned t) {
+                for (T l = 1 + t; l < last; l += threads) part[t] += correction(l);  // interleaved, work shrinks with l
+            });
+            for (T x : part) larges[0] += x;
+        } else {
+            for (T l = 1; l < last; l++) larges[0] += correction(l);
         }
         return larges[0] + 1;
     }
@@ -215,71 +405,215 @@ public:
 };
 
 
+struct FastInput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0, len = 0;
+
+    inline void refill() {
+        len -= pos;
+        std::memmove(buf, buf + pos, len);
+        pos = 0;
+        len += std::fread(buf + len, 1, BUF_SIZE - len, stdin);
+        if (len < BUF_SIZE) buf[len] = '\0';
+    }
+
+    inline char peek() {
+        if (pos == len) refill();
+        return pos < len ? buf[pos] : '\0';
+    }
+
+    inline char skip() {  // skips whitespace, returns the first non-space char ('\0' on EOF)
+        char c;
+        while ((c = peek()) && c <= ' ') pos++;
+        return c;
+    }
+
+public:
+    template <std::integral T>
+    void read(T& x) {
+        skip();
+        if (len - pos < 64) refill();
+        bool neg = false;
+        if constexpr (std::is_signed_v<T>) {
+            if (buf[pos] == '-') neg = true, pos++;
+        }
+        std::make_unsigned_t<T> v = 0;
+        while (pos < len && (unsigned)(buf[pos] - '0') < 10) v = v * 10 + (buf[pos++] - '0');
+        x = neg ? -(T)v : (T)v;
+    }
+
+    void read(char& c) { if ((c = skip())) pos++; }
+
+    void read(std::string& s) {
+        s.clear();
+        for (char c = skip(); c > ' '; c = peek()) s.push_back(c), pos++;
+    }
+
+    void read(double& x) {
+        std::string s;
+        read(s);
+        x = std::stod(s);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); } && std::constructible_from<T, long long>
+    void read(T& x) {  // ModInt
+        long long v;
+        read(v);
+        x = T(v);
+    }
+
+    template <typename T, typename U>
+    void read(std::pair<T, U>& p) { read(p.first), read(p.second); }
+
+    template <typename T>
+    void read(std::vector<T>& v) { for (auto& x : v) read(x); }
+
+    template <typename T>
+    FastInput& operator>>(T& x) { read(x); return *this; }
+};
+
+struct FastOutput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0;
+
+    inline void reserve(int k) {
+        if (pos + k > BUF_SIZE) flush();
+    }
+
+public:
+    ~FastOutput() { flush(); }
+
+    void flush() {
+        std::fwrite(buf, 1, pos, stdout);
+        std::fflush(stdout);
+        pos = 0;
+    }
+
+    template <std::integral T>
+    void write(T x) {
+        reserve(40);
+        std::make_unsigned_t<T> v = x;
+        if constexpr (std::is_signed_v<T>) {
+            if (x < 0) buf[pos++] = '-', v = -v;
+        }
+        char tmp[40];
+        int k = 0;
+        do tmp[k++] = '0' + v % 10; while (v /= 10);
+        while (k) buf[pos++] = tmp[--k];
+    }
+
+    void write(char c) { reserve(1); buf[pos++] = c; }
+
+    void write(const char* s) { write(std::string_view(s)); }
+
+    void write(std::string_view s) {
+        for (size_t i = 0; i < s.size();) {
+            if (pos == BUF_SIZE) flush();
+            size_t k = std::min(s.size() - i, (size_t)(BUF_SIZE - pos));
+            std::memcpy(buf + pos, s.data() + i, k);
+            pos += k, i += k;
+        }
+    }
+
+    void write(double x) {
+        reserve(64);
+        pos += std::snprintf(buf + pos, 64, "%.15f", x);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); }
+    void write(T x) { write(x.value()); }  // ModInt
+
+    template <typename T, typename U>
+    void write(const std::pair<T, U>& p) { write(p.first), write(' '), write(p.second); }
+
+    template <typename T>
+    void write(const std::vector<T>& v) {
+        for (size_t i = 0; i < v.size(); i++) {
+            if (i) write(' ');
+            write(v[i]);
+        }
+    }
+
+    template <typename T>
+    FastOutput& operator<<(const T& x) { write(x); return *this; }
+};
+
+static FastInput in;
+static FastOutput out;
+
+
 int main() {
 
     NumTheory<uint64_t> nt;
 
     // // https://judge.yosupo.jp/problem/primality_test
     // int Q;
-    // std::cin >> Q;
+    // in >> Q;
 
-    // while (Q--) {
-    //     uint64_t N;
-    //     std::cin >> N;
-    //     std::cout << (nt.is_prime(N) ? "Yes" : "No") << std::endl;
+    // std::vector<uint64_t> N(Q);
+    // for (uint64_t& x : N) in >> x;
+
+    // for (bool p : nt.is_prime_many(N)) {
+    //     out << (p ? "Yes" : "No") << '\n';
     // }
 
 
     // // https://judge.yosupo.jp/problem/factorize
     // int Q;
-    // std::cin >> Q;
+    // in >> Q;
 
     // while (Q--) {
     //     uint64_t a;
-    //     std::cin >> a;
+    //     in >> a;
 
-    //     auto mp = nt.factorize(a);
+    //     auto factors = nt.factorize(a);
 
-    //     uint64_t num = 0;
-    //     for (auto& [p, n] : mp) {
+    //     int num = 0;
+    //     for (auto& [p, n] : factors) {
     //         num += n;
     //     }
-    //     std::cout << num << ' ';
+    //     out << num << ' ';
 
-    //     for (auto& [p, n] : mp) {
+    //     for (auto& [p, n] : factors) {
     //         for (int i = 0; i < n; i++) {
-    //             std::cout << p << ' ';
+    //             out << p << ' ';
     //         }
     //     }
-    //     std::cout << std::endl;
+    //     out << '\n';
     // }
 
 
     // //https://judge.yosupo.jp/problem/counting_primes
     // uint64_t N;
-    // std::cin >> N;
+    // in >> N;
 
-    // std::cout << nt.count_primes(N) << std::endl;
+    // out << nt.count_primes(N) << '\n';
 
 
     // // https://judge.yosupo.jp/problem/primitive_root
     // int Q;
-    // std::cin >> Q;
+    // in >> Q;
 
     // while (Q--) {
     //     uint64_t p;
-    //     std::cin >> p;
-    //     std::cout << nt.find_primitive_root(p) << std::endl;
+    //     in >> p;
+    //     out << nt.find_primitive_root(p) << '\n';
     // }
 
     // https://judge.yosupo.jp/problem/tetration_mod
     int T;
-    std::cin >> T;
+    in >> T;
 
     while (T--) {
         uint64_t A, B, M;
-        std::cin >> A >> B >> M;
-        std::cout << nt.tetration(A, B, M) << std::endl;
+        in >> A >> B >> M;
+        out << nt.tetration(A, B, M) << '\n';
     }
 
     return 0;
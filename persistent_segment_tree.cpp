@@ -0,0 +1,320 @@
+#include <concepts>
+#include <vector>
+#include <span>
+#include <bit>
+#include <algorithm>
+#include <functional>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <type_traits>
+
+template <typename F, typename S>
+concept BinaryOperation = requires(F f, S a, S b) {
+    { f(a, b) } -> std::convertible_to<S>;
+};
+
+// Every update path-copies the root-to-leaf path into a node arena and returns a new version; old
+// versions stay readable and untouched. Node 0 is the shared all-e subtree, so an empty tree is
+// one node. Memory: build(v) takes 2n - 1 nodes, each update exactly depth + 1 <= nodes_per_update()
+// = ceil(log2 n) + 1, so k updates on a built tree fit in 2n + k * nodes_per_update() nodes
+// (reserve() that many up front to keep references and timing stable).
+template <typename S, typename F>
+requires BinaryOperation<F, S>
+class PersistentSegmentTree {
+private:
+    struct Node {
+        S val;
+        int ch[2];  // arena indices, 0 = empty subtree
+    };
+
+    int n;
+    std::vector<Node> nodes;
+    std::vector<int> roots;  // roots[v]: root of version v
+    F f;
+    S e;
+
+    int build(std::span<const S> v, int lo, int hi) {
+        if (hi - lo == 1) {
+            nodes.push_back({v[lo], {0, 0}});
+            return nodes.size() - 1;
+        }
+        int mid = (lo + hi) >> 1;
+        int l = build(v, lo, mid), r = build(v, mid, hi);
+        nodes.push_back({f(nodes[l].val, nodes[r].val), {l, r}});
+        return nodes.size() - 1;
+    }
+
+    S query(int k, int lo, int hi, int a, int b) const {
+        if (k == 0 || b <= lo || hi <= a) return e;
+        if (a <= lo && hi <= b) return nodes[k].val;
+        int mid = (lo + hi) >> 1;
+        return f(query(nodes[k].ch[0], lo, mid, a, b), query(nodes[k].ch[1], mid, hi, a, b));
+    }
+
+public:
+    PersistentSegmentTree(int n_, F f_, S e_) : n(n_), f(f_), e(e_) {  // version 0: all e
+        nodes.push_back({e, {0, 0}});
+        roots.push_back(0);
+    }
+
+    PersistentSegmentTree(std::span<const S> v, F f_, S e_) : PersistentSegmentTree(v.size(), f_, e_) {
+        if (n) roots[0] = build(v, 0, n);
+    }
+
+    int nodes_per_update() const { return std::bit_width((unsigned)std::max(n - 1, 0)) + 1; }
+
+    void reserve(int updates) { nodes.reserve(nodes.size() + (size_t)updates * nodes_per_update()); }
+
+    int versions() const { return roots.size(); }
+
+    // version `version` with a[i] = x, stored as a new version whose number is returned
+    int update(int version, int i, const S& x) {
+        int path[32], depth = 0;
+        int old = roots[version], lo = 0, hi = n;
+        roots.push_back(nodes.size());
+        while (true) {
+            path[depth++] = nodes.size();
+            nodes.push_back(nodes[old]);
+            if (hi - lo == 1) break;
+            int mid = (lo + hi) >> 1, d = i >= mid;
+            old = nodes[old].ch[d];
+            nodes[path[depth - 1]].ch[d] = nodes.size();
+            (d ? lo : hi) = mid;
+        }
+        nodes[path[--depth]].val = x;
+        while (depth--) {
+            Node& p = nodes[path[depth]];
+            p.val = f(nodes[p.ch[0]].val, nodes[p.ch[1]].val);
+        }
+        return roots.size() - 1;
+    }
+
+    S get(int version, int i) const { return query(version, i, i + 1); }
+
+    S query(int version, int a, int b) const {  // [a, b) as of version
+        if (a >= b) return e;
+        return query(roots[version], 0, n, a, b);
+    }
+
+    // for counting trees (f = +, leaf i = multiplicity of value i): the k-th (0-indexed) smallest
+    // value of the multiset version hi minus version lo, n if it has at most k elements. Two roots
+    // are walked in lockstep, O(log n)
+    int kth(int lo, int hi, S k) const requires requires(S a, S b) { a - b; a < b; } {
+        int a = roots[lo], b = roots[hi], l = 0, r = n;
+        if (!(k < nodes[b].val - nodes[a].val)) return n;
+        while (r - l > 1) {
+            int mid = (l + r) >> 1;
+            S left = nodes[nodes[b].ch[0]].val - nodes[nodes[a].ch[0]].val;
+            if (k < left) {
+                a = nodes[a].ch[0], b = nodes[b].ch[0], r = mid;
+            } else {
+                k = k - left;
+                a = nodes[a].ch[1], b = nodes[b].ch[1], l = mid;
+            }
+        }
+        return l;
+    }
+};
+
+// k-th smallest of a[l, r) for a static array: version i counts the compressed values of a[0, i)
+template <typename T>
+class RangeKthSmallest {
+private:
+    std::vector<T> vals;
+    PersistentSegmentTree<int, std::plus<int>> seg;
+
+    static std::vector<T> sorted_unique(std::span<const T> a) {
+        std::vector<T> v(a.begin(), a.end());
+        std::sort(v.begin(), v.end());
+        v.erase(std::unique(v.begin(), v.end()), v.end());
+        return v;
+    }
+
+public:
+    RangeKthSmallest(std::span<const T> a) : vals(sorted_unique(a)), seg(vals.size(), {}, 0) {
+        seg.reserve(a.size());
+        for (int i = 0; i < (int)a.size(); i++) {
+            int j = std::lower_bound(vals.begin(), vals.end(), a[i]) - vals.begin();
+            seg.update(i, j, seg.get(i, j) + 1);
+        }
+    }
+
+    T query(int l, int r, int k) const { return vals[seg.kth(l, r, k)]; }  // [l, r), 0 <= k < r - l
+};
+/*
+    // example
+    auto op = [](long long a, long long b) { return a + b; };
+    PersistentSegmentTree<long long, decltype(op)> seg(A, op, 0);   // version 0 = A
+    int v1 = seg.update(0, i, x);       // version 0 with A[i] = x
+    int v2 = seg.update(v1, j, y);
+    seg.query(0, l, r);                 // sum of A[l, r) before either update
+    seg.query(v2, l, r);
+
+    RangeKthSmallest<int> rk(A);
+    rk.query(l, r, k);                  // k-th (0-indexed) smallest of A[l, r)
+*/
+
+struct FastInput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0, len = 0;
+
+    inline void refill() {
+        len -= pos;
+        std::memmove(buf, buf + pos, len);
+        pos = 0;
+        len += std::fread(buf + len, 1, BUF_SIZE - len, stdin);
+        if (len < BUF_SIZE) buf[len] = '\0';
+    }
+
+    inline char peek() {
+        if (pos == len) refill();
+        return pos < len ? buf[pos] : '\0';
+    }
+
+    inline char skip() {  // skips whitespace, returns the first non-space char ('\0' on EOF)
+        char c;
+        while ((c = peek()) && c <= ' ') pos++;
+        return c;
+    }
+
+public:
+    template <std::integral T>
+    void read(T& x) {
+        skip();
+        if (len - pos < 64) refill();
+        bool neg = false;
+        if constexpr (std::is_signed_v<T>) {
+            if (buf[pos] == '-') neg = true, pos++;
+        }
+        std::make_unsigned_t<T> v = 0;
+        while (pos < len && (unsigned)(buf[pos] - '0') < 10) v = v * 10 + (buf[pos++] - '0');
+        x = neg ? -(T)v : (T)v;
+    }
+
+    void read(char& c) { if ((c = skip())) pos++; }
+
+    void read(std::string& s) {
+        s.clear();
+        for (char c = skip(); c > ' '; c = peek()) s.push_back(c), pos++;
+    }
+
+    void read(double& x) {
+        std::string s;
+        read(s);
+        x = std::stod(s);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); } && std::constructible_from<T, long long>
+    void read(T& x) {  // ModInt
+        long long v;
+        read(v);
+        x = T(v);
+    }
+
+    template <typename T, typename U>
+    void read(std::pair<T, U>& p) { read(p.first), read(p.second); }
+
+    template <typename T>
+    void read(std::vector<T>& v) { for (auto& x : v) read(x); }
+
+    template <typename T>
+    FastInput& operator>>(T& x) { read(x); return *this; }
+};
+
+struct FastOutput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0;
+
+    inline void reserve(int k) {
+        if (pos + k > BUF_SIZE) flush();
+    }
+
+public:
+    ~FastOutput() { flush(); }
+
+    void flush() {
+        std::fwrite(buf, 1, pos, stdout);
+        std::fflush(stdout);
+        pos = 0;
+    }
+
+    template <std::integral T>
+    void write(T x) {
+        reserve(40);
+        std::make_unsigned_t<T> v = x;
+        if constexpr (std::is_signed_v<T>) {
+            if (x < 0) buf[pos++] = '-', v = -v;
+        }
+        char tmp[40];
+        int k = 0;
+        do tmp[k++] = '0' + v % 10; while (v /= 10);
+        while (k) buf[pos++] = tmp[--k];
+    }
+
+    void write(char c) { reserve(1); buf[pos++] = c; }
+
+    void write(const char* s) { write(std::string_view(s)); }
+
+    void write(std::string_view s) {
+        for (size_t i = 0; i < s.size();) {
+            if (pos == BUF_SIZE) flush();
+            size_t k = std::min(s.size() - i, (size_t)(BUF_SIZE - pos));
+            std::memcpy(buf + pos, s.data() + i, k);
+            pos += k, i += k;
+        }
+    }
+
+    void write(double x) {
+        reserve(64);
+        pos += std::snprintf(buf + pos, 64, "%.15f", x);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); }
+    void write(T x) { write(x.value()); }  // ModInt
+
+    template <typename T, typename U>
+    void write(const std::pair<T, U>& p) { write(p.first), write(' '), write(p.second); }
+
+    template <typename T>
+    void write(const std::vector<T>& v) {
+        for (size_t i = 0; i < v.size(); i++) {
+            if (i) write(' ');
+            write(v[i]);
+        }
+    }
+
+    template <typename T>
+    FastOutput& operator<<(const T& x) { write(x); return *this; }
+};
+
+static FastInput in;
+static FastOutput out;
+
+
+// https://judge.yosupo.jp/problem/range_kth_smallest
+int main() {
+    int N, Q;
+    in >> N >> Q;
+
+    std::vector<int> A(N);
+    in >> A;
+
+    RangeKthSmallest<int> rk(A);
+
+    while (Q--) {
+        int l, r, k;
+        in >> l >> r >> k;
+        out << rk.query(l, r, k) << '\n';
+    }
+
+    return 0;
+}
@@ -0,0 +1,297 @@
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <bit>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <concepts>
+#include <type_traits>
+
+// primes and smallest prime factors up to n in O(n)
+struct LinearSieve {
+    std::vector<int> primes, spf;  // spf[x] = smallest prime factor of x (x >= 2)
+
+    LinearSieve(int n) : spf(n + 1) {
+        for (int i = 2; i <= n; i++) {
+            if (spf[i] == 0) spf[i] = i, primes.push_back(i);
+            for (int p : primes) {
+                if (p > spf[i] || (long long)i * p > n) break;
+                spf[i * p] = p;
+            }
+        }
+    }
+
+    bool is_prime(int x) const { return x >= 2 && spf[x] == x; }
+
+    std::vector<std::pair<int, int>> factorize(int x) const {  // (prime, exponent), x <= n
+        std::vector<std::pair<int, int>> res;
+        while (x > 1) {
+            int p = spf[x], e = 0;
+            while (x % p == 0) x /= p, e++;
+            res.emplace_back(p, e);
+        }
+        return res;
+    }
+};
+
+// sieve of Eratosthenes over [lo, hi) in cache-sized segments of odd numbers, one bit per odd number
+struct SegmentedSieve {
+private:
+    static constexpr int SEG_BITS = 1 << 18;  // 32 KiB of bits per segment, covering 2^19 integers
+
+    // multiples of these are stamped from a periodic bit pattern instead of being crossed off one by one
+    static constexpr uint32_t PRESIEVE[] = {3, 5, 7, 11, 13};
+    static constexpr int PERIOD = 3 * 5 * 7 * 11 * 13;
+
+    static std::vector<uint32_t> base_primes(uint64_t hi) {  // odd primes p with p * p < hi
+        uint32_t r = std::sqrt((long double)hi);
+        while ((uint64_t)r * r >= hi && r) r--;
+        std::vector<bool> comp(r + 1);
+        std::vector<uint32_t> ps;
+        for (uint32_t i = 3; i <= r; i += 2) {
+            if (comp[i]) continue;
+            ps.push_back(i);
+            for (uint64_t j = (uint64_t)i * i; j <= r; j += 2 * i) comp[j] = true;
+        }
+        return ps;
+    }
+
+public:
+    // calls f(p) for every prime lo <= p < hi, in increasing order
+    template <typename F>
+    static void for_each_prime(uint64_t lo, uint64_t hi, F f) {
+        if (lo <= 2 && 2 < hi) f(uint64_t(2));
+        lo = std::max<uint64_t>(lo, 3) | 1;  // first odd candidate
+        if (lo >= hi) return;
+
+        const std::vector<uint32_t> ps = base_primes(hi);
+        std::vector<uint64_t> next(ps.size());  // bit index of the next odd multiple, relative to the current segment
+        for (size_t i = 0; i < ps.size(); i++) {
+            const uint64_t p = ps[i];
+            uint64_t m = std::max(p * p, (lo + p - 1) / p * p);
+            if (~m & 1) m += p;
+            next[i] = (m - lo) >> 1;
+        }
+
+        std::vector<uint64_t> pattern((PERIOD + 128) / 64 + 1);  // bit t: lo + 2t has a factor in PRESIEVE
+        for (uint64_t t = 0; t < PERIOD + 128; t++) {
+            for (uint32_t p : PRESIEVE) {
+                if ((lo + 2 * t) % p == 0) {
+                    pattern[t >> 6] |= 1ULL << (t & 63);
+                    break;
+                }
+            }
+        }
+        const size_t first = std::upper_bound(ps.begin(), ps.end(), PRESIEVE[4]) - ps.begin();
+
+        std::vector<uint64_t> bits(SEG_BITS / 64);
+        uint64_t phase = 0;
+        for (uint64_t seg = lo; seg < hi; seg += 2 * (uint64_t)SEG_BITS) {
+            const uint64_t len = std::min<uint64_t>(SEG_BITS, (hi - seg + 1) >> 1);  // odd numbers in this segment
+            for (uint64_t k = 0; k * 64 < len; k++) {
+                const uint64_t o = phase & 63, *q = pattern.data() + (phase >> 6);
+                bits[k] = o ? q[0] >> o | q[1] << (64 - o) : q[0];
+                if ((phase += 64) >= PERIOD) phase -= PERIOD;
+            }
+            for (uint32_t p : PRESIEVE) {
+                if (seg <= p && p < seg + 2 * len) bits[(p - seg) >> 7] &= ~(1ULL << ((p - seg) >> 1 & 63));
+            }
+            for (size_t i = first; i < ps.size(); i++) {
+                uint64_t j = next[i];
+                for (const uint64_t p = ps[i]; j < len; j += p) bits[j >> 6] |= 1ULL << (j & 63);
+                next[i] = j - len;
+            }
+            for (uint64_t k = 0; k * 64 < len; k++) {
+                uint64_t w = ~bits[k];
+                if (len - k * 64 < 64) w &= (1ULL << (len - k * 64)) - 1;
+                while (w) {
+                    f(seg + 2 * (k * 64 + std::countr_zero(w)));
+                    w &= w - 1;
+                }
+            }
+        }
+    }
+
+    static std::vector<uint64_t> primes(uint64_t lo, uint64_t hi) {
+        std::vector<uint64_t> res;
+        for_each_prime(lo, hi, [&](uint64_t p) { res.push_back(p); });
+        return res;
+    }
+
+    static uint64_t count(uint64_t lo, uint64_t hi) {
+        uint64_t c = 0;
+        for_each_prime(lo, hi, [&](uint64_t) { c++; });
+        return c;
+    }
+};
+/*
+    // example
+    SegmentedSieve::for_each_prime(L, R, [&](uint64_t p) { ... });  // primes in [L, R)
+    LinearSieve ls(n);  // ls.spf, ls.primes, ls.factorize(x)
+*/
+
+
+struct FastInput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0, len = 0;
+
+    inline void refill() {
+        len -= pos;
+        std::memmove(buf, buf + pos, len);
+        pos = 0;
+        len += std::fread(buf + len, 1, BUF_SIZE - len, stdin);
+        if (len < BUF_SIZE) buf[len] = '\0';
+    }
+
+    inline char peek() {
+        if (pos == len) refill();
+        return pos < len ? buf[pos] : '\0';
+    }
+
+    inline char skip() {  // skips whitespace, returns the first non-space char ('\0' on EOF)
+        char c;
+        while ((c = peek()) && c <= ' ') pos++;
+        return c;
+    }
+
+public:
+    template <std::integral T>
+    void read(T& x) {
+        skip();
+        if (len - pos < 64) refill();
+        bool neg = false;
+        if constexpr (std::is_signed_v<T>) {
+            if (buf[pos] == '-') neg = true, pos++;
+        }
+        std::make_unsigned_t<T> v = 0;
+        while (pos < len && (unsigned)(buf[pos] - '0') < 10) v = v * 10 + (buf[pos++] - '0');
+        x = neg ? -(T)v : (T)v;
+    }
+
+    void read(char& c) { if ((c = skip())) pos++; }
+
+    void read(std::string& s) {
+        s.clear();
+        for (char c = skip(); c > ' '; c = peek()) s.push_back(c), pos++;
+    }
+
+    void read(double& x) {
+        std::string s;
+        read(s);
+        x = std::stod(s);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); } && std::constructible_from<T, long long>
+    void read(T& x) {  // ModInt
+        long long v;
+        read(v);
+        x = T(v);
+    }
+
+    template <typename T, typename U>
+    void read(std::pair<T, U>& p) { read(p.first), read(p.second); }
+
+    template <typename T>
+    void read(std::vector<T>& v) { for (auto& x : v) read(x); }
+
+    template <typename T>
+    FastInput& operator>>(T& x) { read(x); return *this; }
+};
+
+struct FastOutput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0;
+
+    inline void reserve(int k) {
+        if (pos + k > BUF_SIZE) flush();
+    }
+
+public:
+    ~FastOutput() { flush(); }
+
+    void flush() {
+        std::fwrite(buf, 1, pos, stdout);
+        std::fflush(stdout);
+        pos = 0;
+    }
+
+    template <std::integral T>
+    void write(T x) {
+        reserve(40);
+        std::make_unsigned_t<T> v = x;
+        if constexpr (std::is_signed_v<T>) {
+            if (x < 0) buf[pos++] = '-', v = -v;
+        }
+        char tmp[40];
+        int k = 0;
+        do tmp[k++] = '0' + v % 10; while (v /= 10);
+        while (k) buf[pos++] = tmp[--k];
+    }
+
+    void write(char c) { reserve(1); buf[pos++] = c; }
+
+    void write(const char* s) { write(std::string_view(s)); }
+
+    void write(std::string_view s) {
+        for (size_t i = 0; i < s.size();) {
+            if (pos == BUF_SIZE) flush();
+            size_t k = std::min(s.size() - i, (size_t)(BUF_SIZE - pos));
+            std::memcpy(buf + pos, s.data() + i, k);
+            pos += k, i += k;
+        }
+    }
+
+    void write(double x) {
+        reserve(64);
+        pos += std::snprintf(buf + pos, 64, "%.15f", x);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); }
+    void write(T x) { write(x.value()); }  // ModInt
+
+    template <typename T, typename U>
+    void write(const std::pair<T, U>& p) { write(p.first), write(' '), write(p.second); }
+
+    template <typename T>
+    void write(const std::vector<T>& v) {
+        for (size_t i = 0; i < v.size(); i++) {
+            if (i) write(' ');
+            write(v[i]);
+        }
+    }
+
+    template <typename T>
+    FastOutput& operator<<(const T& x) { write(x); return *this; }
+};
+
+static FastInput in;
+static FastOutput out;
+
+
+// https://judge.yosupo.jp/problem/enumerate_primes
+int main() {
+    int N, A, B;
+    in >> N >> A >> B;
+
+    std::vector<int> ans;
+    long long pi = 0;
+    SegmentedSieve::for_each_prime(0, N + 1, [&](uint64_t p) {
+        if (pi % A == B) ans.push_back(p);
+        pi++;
+    });
+
+    out << pi << ' ' << ans.size() << '\n';
+    out << ans << '\n';
+
+    return 0;
+}
@@ -1,19 +1,63 @@
-#include <iostream>
 #include <concepts>
 #include <vector>
 #include <span>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <utility>
+#include <type_traits>
+#include <new>
+#include <limits>
+#include <thread>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
 template <typename F, typename S>
 concept BinaryOperation = requires(F f, S a, S b) {
     { f(a, b) } -> std::convertible_to<S>;
 };
 
-template<typename S, typename F>
+// node layouts for SegmentTree
+struct HeapLayout {     // data[k] = f(data[2k], data[2k+1]), n rounded up to a power of two
+    static constexpr int arity = 2;
+    static constexpr bool pow2 = true, blocked = false;
+};
+struct CompactLayout {  // same order without rounding: 2n nodes, leaves at n + i (no max_right/min_left)
+    static constexpr int arity = 2;
+    static constexpr bool pow2 = false, blocked = false;
+};
+template <int B = 0>    // B-ary tree stored level by level, one node's children per cache line (B = 0: 64 / sizeof(S))
+struct BlockedLayout {
+    static_assert(B == 0 || B >= 2);
+    static constexpr int arity = B;
+    static constexpr bool pow2 = false, blocked = true;
+};
+
+template <typename T, std::size_t Align = 64>
+struct AlignedAllocator {
+    using value_type = T;
+    template <typename U> struct rebind { using other = AlignedAllocator<U, Align>; };
+    AlignedAllocator() = default;
+    template <typename U> AlignedAllocator(const AlignedAllocator<U, Align>&) {}
+    T* allocate(std::size_t k) { return static_cast<T*>(::operator new(k * sizeof(T), std::align_val_t(Align))); }
+    void deallocate(T* p, std::size_t) { ::operator delete(p, std::align_val_t(Align)); }
+    bool operator==(const AlignedAllocator&) const { return true; }
+};
+
+template<typename S, typename F, typename Layout = HeapLayout>
 requires BinaryOperation<F, S>
 class SegmentTree {
 private:
-    int n;
-    std::vector<S> data;
+    static constexpr int B = Layout::arity == 0 ? std::max<int>(2, 64 / sizeof(S)) : Layout::arity;
+    static constexpr bool blocked = Layout::blocked;
+    static constexpr int PARALLEL_BUILD = 1 << 17;  // leaves per thread below which build() stays serial
+
+    int n, len;
+    std::vector<S, AlignedAllocator<S>> data;
+    std::vector<int> level;  // blocked: offset of each level in data, leaves first, root last
     F f;
     S e;
 
@@ -21,41 +65,320 @@ private:
         data[k] = f(data[k << 1], data[(k << 1) | 1]);
     }
 
+    // fold of a whole block as a balanced tree: fixed shape, short dependency chains
+    template <int L = 0, int R = B>
+    inline S fold_block(const S* c) const {
+        if constexpr (R - L == 1) {
+            return c[L];
+        } else {
+            constexpr int M = (L + R) / 2;
+            return f(fold_block<L, M>(c), fold_block<M, R>(c));
+        }
+    }
+
+    template <typename G>
+    static void run_parallel(unsigned threads, G g) {  // g(t) for t = 0 .. threads - 1, t = 0 on the calling thread
+        std::vector<std::thread> pool;
+        for (unsigned t = 1; t < threads; t++) pool.emplace_back(g, t);
+        g(0);
+        for (auto& th : pool) th.join();
+    }
+
 public:
-    SegmentTree(int n_, F f_, S e_) : f(f_), e(e_) {
-        n = 1;
-        while (n < n_) n <<= 1;
-        data.assign(n << 1, e);
+    SegmentTree(int n_, F f_, S e_) : len(n_), f(f_), e(e_) {
+        if constexpr (blocked) {
+            n = 0;
+            for (int cnt = n_;; cnt = (cnt + B - 1) / B) {
+                level.push_back(n);
+                n += (cnt + B - 1) / B * B;
+                if (cnt <= 1) break;
+            }
+            data.assign(n, e);
+        } else {
+            n = n_;
+            if constexpr (Layout::pow2) {
+                n = 1;
+                while (n < n_) n <<= 1;
+            }
+            data.assign(n << 1, e);
+        }
     }
 
-    S operator[](int i) const { return data[n + i]; }
+    S operator[](int i) const { return data[blocked ? i : n + i]; }
 
     void update(int i, const S& x) {
-        data[i += n] = x;
-        while (i >>= 1) update_node(i);
+        if constexpr (blocked) {
+            for (int h = 0, j = i; h < (int)level.size(); h++, j /= B) {
+                __builtin_prefetch(&data[level[h] + j / B * B]);
+            }
+            data[i] = x;
+            for (int h = 0; h + 1 < (int)level.size(); h++) {
+                i /= B;
+                data[level[h + 1] + i] = fold_block(&data[level[h] + i * B]);
+            }
+        } else {
+            data[i += n] = x;
+            while (i >>= 1) update_node(i);
+        }
     }
 
-    void build(std::span<const S> v = {}) {
-        for (int i = 0; i < (int)v.size(); i++) {
-            data[n + i] = v[i];
+    // threads > 1 builds disjoint subtrees in parallel (each thread owns a slice of one level and
+    // everything below it), then the few levels above them serially. Below PARALLEL_BUILD leaves the
+    // thread start-up costs more than the pass itself, so small trees stay serial
+    void build(std::span<const S> v = {}, unsigned threads = 1) {
+        threads = std::min<long long>(threads, len / PARALLEL_BUILD);
+        if (threads <= 1) {
+            if constexpr (blocked) {
+                for (int i = 0; i < (int)v.size(); i++) {
+                    data[i] = v[i];
+                }
+                for (int h = 0; h + 1 < (int)level.size(); h++) {
+                    for (int p = level[h], i = level[h + 1]; p < level[h + 1]; p += B, i++) {
+                        data[i] = fold_block(&data[p]);
+                    }
+                }
+            } else {
+                for (int i = 0; i < (int)v.size(); i++) {
+                    data[n + i] = v[i];
+                }
+                for (int i = n - 1; i > 0; i--) {
+                    update_node(i);
+                }
+            }
+            return;
         }
-        for (int i = n - 1; i > 0; i--) {
-            update_node(i);
+
+        const int leaf = blocked ? 0 : n, m = v.size();
+        run_parallel(threads, [&](unsigned t) {
+            std::copy(v.begin() + (long long)m * t / threads, v.begin() + (long long)m * (t + 1) / threads,
+                      data.begin() + leaf + (long long)m * t / threads);
+        });
+        if constexpr (blocked) {
+            // nodes(h): nodes on level h >= 1, node i of level h folds block i of level h - 1
+            auto nodes = [&](int h) { return (level[h] - level[h - 1]) / B; };
+            int top = 1;
+            while (top + 1 < (int)level.size() && nodes(top + 1) >= (int)threads * 4) top++;
+            run_parallel(threads, [&](unsigned t) {
+                std::vector<std::pair<int, int>> own(top + 1);
+                own[top] = {(long long)nodes(top) * t / threads, (long long)nodes(top) * (t + 1) / threads};
+                for (int h = top; h > 1; h--) own[h - 1] = {own[h].first * B, own[h].second * B};
+                for (int h = 1; h <= top; h++) {
+                    for (int i = own[h].first; i < std::min(own[h].second, nodes(h)); i++) {
+                        data[level[h] + i] = fold_block(&data[level[h - 1] + i * B]);
+                    }
+                }
+            });
+            for (int h = top + 1; h < (int)level.size(); h++) {
+                for (int i = 0; i < nodes(h); i++) {
+                    data[level[h] + i] = fold_block(&data[level[h - 1] + i * B]);
+                }
+            }
+        } else {
+            // depth d holds nodes [2^d, 2^(d+1)); children of [a, b) are [2a, 2b)
+            int top = 1;
+            while (top < (int)threads * 4) top <<= 1;
+            run_parallel(threads, [&](unsigned t) {
+                const long long lo = top + (long long)top * t / threads, hi = top + (long long)top * (t + 1) / threads;
+                int k = 0;
+                while ((lo << (k + 1)) < n) k++;
+                for (; k >= 0; k--) {
+                    for (long long i = std::min<long long>(hi << k, n) - 1; i >= (lo << k); i--) update_node(i);
+                }
+            });
+            for (int i = top - 1; i > 0; i--) {
+                update_node(i);
+            }
         }
     }
 
     S query(int a, int b) const {  // [a, b)
         if (a >= b) return e;
         S vl = e, vr = e;
+        if constexpr (blocked) {
+            // touch both boundary lines on every level first, so the misses overlap instead of
+            // waiting behind the folds of the levels below
+            for (int h = 0, x = a, y = b - 1; x != y && h < (int)level.size(); h++, x /= B, y /= B) {
+                __builtin_prefetch(&data[level[h] + x]);
+                __builtin_prefetch(&data[level[h] + y]);
+            }
+            for (int h = 0; a < b; h++) {
+                const S* d = &data[level[h]];
+                int ae = std::min(b, (a + B - 1) / B * B), bs = std::max(ae, b / B * B);
+                for (; a < ae; a++) vl = f(vl, d[a]);
+                while (b > bs) vr = f(d[--b], vr);
+                a /= B;
+                b /= B;
+            }
+            return f(vl, vr);
+        }
+        // data[0] is never a node and holds e: selecting the index instead of branching on l & 1 / r & 1
+        // leaves no data-dependent branch but the loop exit (those branches mispredict half the time)
         int l = a + n, r = b + n;
         while (l < r) {
-            if (l & 1) vl = f(vl, data[l++]);
-            if (r & 1) vr = f(data[--r], vr);
-            l >>= 1;
+            vl = f(vl, data[l & -(l & 1)]);
+            vr = f(data[(r - 1) & -(r & 1)], vr);
+            l = (l + 1) >> 1;
             r >>= 1;
         }
         return f(vl, vr);
     }
+
+    // largest r with pred(query(l, r)); pred must be monotone and pred(e) true, O(log n)
+    template <typename P>
+    requires (Layout::pow2 || blocked)
+    int max_right(int l, P pred) const {
+        if (l == len) return len;
+        S sm = e;
+        if constexpr (blocked) {
+            int h = 0;
+            for (;; h++) {
+                const S* d = &data[level[h]];
+                for (int end = (l / B + 1) * B; l < end; l++) {
+                    if (!pred(f(sm, d[l]))) goto descend;
+                    sm = f(sm, d[l]);
+                }
+                if (h + 1 == (int)level.size() || l == level[h + 1] - level[h]) return len;
+                l /= B;
+            }
+        descend:
+            while (h--) {
+                const S* d = &data[level[h]];
+                for (l *= B; pred(f(sm, d[l])); l++) sm = f(sm, d[l]);
+            }
+            return l;
+        }
+        l += n;
+        do {
+            while (~l & 1) l >>= 1;
+            if (!pred(f(sm, data[l]))) {
+                while (l < n) {
+                    l <<= 1;
+                    if (pred(f(sm, data[l]))) sm = f(sm, data[l++]);
+                }
+                return l - n;
+            }
+            sm = f(sm, data[l++]);
+        } while ((l & -l) != l);
+        return len;
+    }
+
+    // smallest l with pred(query(l, r)); pred must be monotone and pred(e) true, O(log n)
+    template <typename P>
+    requires (Layout::pow2 || blocked)
+    int min_left(int r, P pred) const {
+        if (r == 0) return 0;
+        S sm = e;
+        if constexpr (blocked) {
+            int h = 0;
+            for (;; h++) {
+                const S* d = &data[level[h]];
+                while (r % B) {
+                    if (!pred(f(d[--r], sm))) goto descend;
+                    sm = f(d[r], sm);
+                }
+                if (r == 0) return 0;
+                r /= B;
+            }
+        descend:
+            while (h--) {
+                const S* d = &data[level[h]];
+                for (r = r * B + B - 1; pred(f(d[r], sm)); r--) sm = f(d[r], sm);
+            }
+            return r + 1;
+        }
+        r += n;
+        do {
+            r--;
+            while (r > 1 && (r & 1)) r >>= 1;
+            if (!pred(f(data[r], sm))) {
+                while (r < n) {
+                    r = (r << 1) | 1;
+                    if (pred(f(data[r], sm))) sm = f(data[r--], sm);
+                }
+                return r + 1 - n;
+            }
+            sm = f(data[r], sm);
+        } while ((r & -r) != r);
+        return 0;
+    }
+
+    // out[j] = query(qs[j]) for an offline batch. The queries are bucketed by l (one counting-sort pass,
+    // about one bucket per query) so consecutive ones share most of their left paths, and the low
+    // levels of the paths PREFETCH queries ahead are requested early. threads > 1 splits the sorted
+    // order into contiguous chunks (queries are read-only).
+    void query_batch(std::span<const std::pair<int, int>> qs, std::span<S> out, unsigned threads = 1) const {
+        constexpr int PREFETCH = 8;
+        struct Q { int l, r, j; };
+        const int k = qs.size();
+        int shift = 0;
+        while ((len >> shift) >= std::max(k, 1)) shift++;
+        std::vector<int> cnt((len >> shift) + 2);
+        for (auto& [l, r] : qs) cnt[(l >> shift) + 1]++;
+        for (int i = 1; i < (int)cnt.size(); i++) cnt[i] += cnt[i - 1];
+        std::vector<Q> sorted(k);
+        for (int j = 0; j < k; j++) sorted[cnt[qs[j].first >> shift]++] = {qs[j].first, qs[j].second, j};
+
+        threads = std::max(1u, std::min<unsigned>(threads, k / 1024 + 1));
+        run_parallel(threads, [&](unsigned t) {
+            const int lo = (long long)k * t / threads, hi = (long long)k * (t + 1) / threads;
+            for (int j = lo; j < hi; j++) {
+                // request the lowest levels of both boundary paths, the part of a query that misses cache
+                // (kept inline: a helper made only of prefetches is dropped as side-effect free by GCC)
+                if (j + PREFETCH < hi && sorted[j + PREFETCH].l < sorted[j + PREFETCH].r) {
+                    int l = sorted[j + PREFETCH].l, r = sorted[j + PREFETCH].r - 1;
+                    if constexpr (blocked) {
+                        for (int h = 0; h < 3 && h < (int)level.size(); h++, l /= B, r /= B) {
+                            __builtin_prefetch(&data[level[h] + l]);
+                            __builtin_prefetch(&data[level[h] + r]);
+                        }
+                    } else {
+                        for (int i = 0; i < 8; i++) {
+                            __builtin_prefetch(&data[(l + n) >> i]);
+                            __builtin_prefetch(&data[(r + n) >> i]);
+                        }
+                    }
+                }
+                out[sorted[j].j] = query(sorted[j].l, sorted[j].r);
+            }
+        });
+    }
+
+    // update(i, x) for every (i, x) in order; each changed node is recomputed once rather than once per
+    // update, and a batch touching more than 1/16 of the leaves just rebuilds the tree in O(n)
+    void update_batch(std::span<const std::pair<int, S>> ups) {
+        for (auto& [i, x] : ups) data[blocked ? i : n + i] = x;
+        if ((long long)ups.size() * 16 >= len) {
+            build();
+            return;
+        }
+        std::vector<int> cur;
+        cur.reserve(ups.size());
+        for (auto& [i, x] : ups) cur.push_back(i);
+        std::sort(cur.begin(), cur.end());
+        cur.erase(std::unique(cur.begin(), cur.end()), cur.end());
+        if constexpr (blocked) {
+            for (int h = 0; h + 1 < (int)level.size(); h++) {
+                int m = 0;
+                for (int i : cur) {
+                    if (m == 0 || cur[m - 1] != i / B) cur[m++] = i / B;
+                }
+                cur.resize(m);
+                for (int i : cur) data[level[h + 1] + i] = fold_block(&data[level[h] + i * B]);
+            }
+        } else {
+            // a node's last appearance comes after all its children's, so every recompute that sticks
+            // sees final children (leaves of CompactLayout sit on two depths)
+            for (int& i : cur) i += n;
+            while (!cur.empty()) {
+                int m = 0;
+                for (int i : cur) {
+                    if ((i >> 1) && (m == 0 || cur[m - 1] != (i >> 1))) cur[m++] = i >> 1;
+                }
+                cur.resize(m);
+                for (int i : cur) update_node(i);
+            }
+        }
+    }
 };
 /*
     // example
@@ -63,26 +386,372 @@ public:
     auto op = [] (S x1, S x2) { return std::max(x1, x2); };
     const S id = std::numeric_limits<S>::min();
     SegmentTree<S, decltype(op)> seg(n, op, id);
+    int r = seg.max_right(l, [&](S x) { return x < k; });  // first r >= l with A[r] >= k (n if none)
+
+    std::vector<std::pair<int, int>> qs;  // offline [l, r) queries
+    std::vector<S> ans(qs.size());
+    seg.query_batch(qs, ans, std::thread::hardware_concurrency());
+    seg.update_batch(std::vector<std::pair<int, S>>{{i, x}, {j, y}});
+
+    // large n: fewer cache lines per operation
+    SegmentTree<S, decltype(op), BlockedLayout<>> seg(n, op, id);   // 16-ary for int, ~n * 16/15 nodes
+    SegmentTree<S, decltype(op), CompactLayout> seg(n, op, id);     // exactly 2n nodes
+*/
+
+// monoids with a vectorized SimdSegmentTree; as plain functors they also work with SegmentTree
+struct SumOp {
+    template <typename T> static constexpr T identity() { return T(0); }
+    template <typename T> constexpr T operator()(T a, T b) const { return a + b; }
+};
+struct MinOp {
+    template <typename T> static constexpr T identity() { return std::numeric_limits<T>::max(); }
+    template <typename T> constexpr T operator()(T a, T b) const { return std::min(a, b); }
+};
+struct MaxOp {
+    template <typename T> static constexpr T identity() { return std::numeric_limits<T>::lowest(); }
+    template <typename T> constexpr T operator()(T a, T b) const { return std::max(a, b); }
+};
+
+template <typename T, typename Op>
+concept SimdMonoid = (std::same_as<Op, SumOp> || std::same_as<Op, MinOp> || std::same_as<Op, MaxOp>)
+                     && std::signed_integral<T> && (sizeof(T) == 4 || sizeof(T) == 8);
+
+// any other (S, F): the generic tree, same constructor and interface
+template <typename T, typename Op>
+class SimdSegmentTree : public SegmentTree<T, Op> {
+public:
+    using SegmentTree<T, Op>::SegmentTree;
+};
+
+// Cache-line-ary tree (16 children for int, 8 for long long) over sum, min or max, stored level by
+// level in 64-byte aligned blocks. A query folds at most two blocks per level (5-7 levels up to
+// 10^6) with masked AVX2 lanes into one vector accumulator, reduced once at the end; an update
+// refolds one block per level.
+// Compiled without -mavx2 / -march=native the same walk runs on scalars.
+template <typename T, typename Op>
+requires SimdMonoid<T, Op>
+class SimdSegmentTree<T, Op> {
+public:
+#ifdef __AVX2__
+    static constexpr bool has_avx2 = true;
+#else
+    static constexpr bool has_avx2 = false;
+#endif
+
+private:
+    static constexpr int B = 64 / sizeof(T);  // one cache line per block
+    int len;
+    std::vector<T, AlignedAllocator<T>> data;
+    std::vector<int> level;  // offset of each level in data, leaves first, root last
+    Op f;
+    T e;
+
+#ifdef __AVX2__
+    static constexpr int L = 32 / sizeof(T), K = B / L;  // lanes per register, registers per block
+    using V = __m256i;
+
+    static V splat(T x) {
+        if constexpr (sizeof(T) == 4) return _mm256_set1_epi32(x);
+        else return _mm256_set1_epi64x(x);
+    }
+    static V gt(V a, V b) {
+        if constexpr (sizeof(T) == 4) return _mm256_cmpgt_epi32(a, b);
+        else return _mm256_cmpgt_epi64(a, b);
+    }
+    static V op(V a, V b) {
+        if constexpr (std::same_as<Op, SumOp>) {
+            if constexpr (sizeof(T) == 4) return _mm256_add_epi32(a, b);
+            else return _mm256_add_epi64(a, b);
+        } else if constexpr (sizeof(T) == 4) {
+            if constexpr (std::same_as<Op, MinOp>) return _mm256_min_epi32(a, b);
+            else return _mm256_max_epi32(a, b);
+        } else {  // no 64-bit min/max before AVX-512
+            if constexpr (std::same_as<Op, MinOp>) return _mm256_blendv_epi8(a, b, gt(a, b));
+            else return _mm256_blendv_epi8(a, b, gt(b, a));
+        }
+    }
+    T reduce(V a) const {
+        a = op(a, _mm256_permute2x128_si256(a, a, 1));
+        a = op(a, _mm256_shuffle_epi32(a, 0x4E));
+        if constexpr (sizeof(T) == 4) {
+            a = op(a, _mm256_shuffle_epi32(a, 0xB1));
+            return _mm256_cvtsi256_si32(a);
+        } else {
+            return _mm256_extract_epi64(a, 0);
+        }
+    }
+    static V lane_index(int k) {  // k * L + (0, 1, ..., L - 1)
+        if constexpr (sizeof(T) == 4) return _mm256_add_epi32(_mm256_set1_epi32(k * L), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        else return _mm256_add_epi64(_mm256_set1_epi64x(k * L), _mm256_setr_epi64x(0, 1, 2, 3));
+    }
+
+    // acc[k] = op(acc[k], c[j]) for j in [lo, hi) of the block, e elsewhere
+    void fold_into(V* acc, const T* c, int lo, int hi) const {
+        V vlo = splat(lo - 1), vhi = splat(hi), ve = splat(e);
+        for (int k = 0; k < K; k++) {
+            V idx = lane_index(k);
+            V in = _mm256_and_si256(gt(idx, vlo), gt(vhi, idx));
+            V x = _mm256_load_si256((const V*)(c + k * L));
+            acc[k] = op(acc[k], _mm256_blendv_epi8(ve, x, in));
+        }
+    }
+
+#endif
+
+    T fold_block(const T* c) const {
+#ifdef __AVX2__
+        if constexpr (sizeof(T) == 4 || std::same_as<Op, SumOp>) {  // emulated 64-bit min/max is slower than scalar here
+            V x = _mm256_load_si256((const V*)c);
+            for (int k = 1; k < K; k++) x = op(x, _mm256_load_si256((const V*)(c + k * L)));
+            return reduce(x);
+        }
+#endif
+        T x = c[0];
+        for (int j = 1; j < B; j++) x = f(x, c[j]);
+        return x;
+    }
+
+public:
+    SimdSegmentTree(int n_, Op f_ = {}, T e_ = Op::template identity<T>()) : len(n_), f(f_), e(e_) {
+        int n = 0;
+        for (int cnt = n_;; cnt = (cnt + B - 1) / B) {
+            level.push_back(n);
+            n += (cnt + B - 1) / B * B;
+            if (cnt <= 1) break;
+        }
+        data.assign(n, e);
+    }
+
+    T operator[](int i) const { return data[i]; }
+
+    void update(int i, const T& x) {
+        data[i] = x;
+        for (int h = 0; h + 1 < (int)level.size(); h++) {
+            i /= B;
+            data[level[h + 1] + i] = fold_block(&data[level[h] + i * B]);
+        }
+    }
+
+    void build(std::span<const T> v = {}) {
+        std::copy(v.begin(), v.end(), data.begin());
+        for (int h = 0; h + 1 < (int)level.size(); h++) {
+            for (int p = level[h], i = level[h + 1]; p < level[h + 1]; p += B, i++) {
+                data[i] = fold_block(&data[p]);
+            }
+        }
+    }
+
+    T query(int a, int b) const {  // [a, b)
+        if (a >= b) return e;
+#ifdef __AVX2__
+        V acc[K];
+        for (int k = 0; k < K; k++) acc[k] = splat(e);
+        auto fold = [&](const T* c, int lo, int hi) { fold_into(acc, c, lo, hi); };
+#else
+        T acc = e;
+        auto fold = [&](const T* c, int lo, int hi) { for (int j = lo; j < hi; j++) acc = f(acc, c[j]); };
+#endif
+        for (int h = 0, x = a / B * B, y = (b - 1) / B * B; h < (int)level.size(); h++, x = x / B / B * B, y = y / B / B * B) {
+            for (int j = 0; j < B; j += 64 / sizeof(T)) {  // both boundary blocks of every level, up front
+                __builtin_prefetch(&data[level[h] + x + j]);
+                __builtin_prefetch(&data[level[h] + y + j]);
+            }
+            if (x == y) break;
+        }
+        for (int h = 0; a < b; h++) {
+            const T* d = &data[level[h]];
+            int ab = a / B * B, bb = b / B * B;
+            if (ab == bb) {
+                fold(d + ab, a - ab, b - ab);
+                break;
+            }
+            if (a != ab) fold(d + ab, a - ab, B), a = ab + B;
+            if (b != bb) fold(d + bb, 0, b - bb);
+            a /= B;
+            b /= B;
+        }
+#ifdef __AVX2__
+        for (int k = 1; k < K; k++) acc[0] = op(acc[0], acc[k]);
+        return reduce(acc[0]);
+#else
+        return acc;
+#endif
+    }
+
+    T prefix(int r) const { return query(0, r); }  // [0, r)
+};
+/*
+    // example
+    SimdSegmentTree<long long, SumOp> seg(n);       // e defaults to Op::identity<T>()
+    SimdSegmentTree<int, MinOp> rmq(n);
+    seg.build(A);
+    seg.update(i, x);
+    long long s = seg.query(l, r);
+
+    // other monoids fall back to SegmentTree<S, F>, so the same spelling works for them
+    SimdSegmentTree<std::pair<mint, mint>, decltype(op)> seg2(n, op, {1, 0});
 */
 
 
+struct FastInput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0, len = 0;
+
+    inline void refill() {
+        len -= pos;
+        std::memmove(buf, buf + pos, len);
+        pos = 0;
+        len += std::fread(buf + len, 1, BUF_SIZE - len, stdin);
+        if (len < BUF_SIZE) buf[len] = '\0';
+    }
+
+    inline char peek() {
+        if (pos == len) refill();
+        return pos < len ? buf[pos] : '\0';
+    }
+
+    inline char skip() {  // skips whitespace, returns the first non-space char ('\0' on EOF)
+        char c;
+        while ((c = peek()) && c <= ' ') pos++;
+        return c;
+    }
+
+public:
+    template <std::integral T>
+    void read(T& x) {
+        skip();
+        if (len - pos < 64) refill();
+        bool neg = false;
+        if constexpr (std::is_signed_v<T>) {
+            if (buf[pos] == '-') neg = true, pos++;
+        }
+        std::make_unsigned_t<T> v = 0;
+        while (pos < len && (unsigned)(buf[pos] - '0') < 10) v = v * 10 + (buf[pos++] - '0');
+        x = neg ? -(T)v : (T)v;
+    }
+
+    void read(char& c) { if ((c = skip())) pos++; }
+
+    void read(std::string& s) {
+        s.clear();
+        for (char c = skip(); c > ' '; c = peek()) s.push_back(c), pos++;
+    }
+
+    void read(double& x) {
+        std::string s;
+        read(s);
+        x = std::stod(s);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); } && std::constructible_from<T, long long>
+    void read(T& x) {  // ModInt
+        long long v;
+        read(v);
+        x = T(v);
+    }
+
+    template <typename T, typename U>
+    void read(std::pair<T, U>& p) { read(p.first), read(p.second); }
+
+    template <typename T>
+    void read(std::vector<T>& v) { for (auto& x : v) read(x); }
+
+    template <typename T>
+    FastInput& operator>>(T& x) { read(x); return *this; }
+};
+
+struct FastOutput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0;
+
+    inline void reserve(int k) {
+        if (pos + k > BUF_SIZE) flush();
+    }
+
+public:
+    ~FastOutput() { flush(); }
+
+    void flush() {
+        std::fwrite(buf, 1, pos, stdout);
+        std::fflush(stdout);
+        pos = 0;
+    }
+
+    template <std::integral T>
+    void write(T x) {
+        reserve(40);
+        std::make_unsigned_t<T> v = x;
+        if constexpr (std::is_signed_v<T>) {
+            if (x < 0) buf[pos++] = '-', v = -v;
+        }
+        char tmp[40];
+        int k = 0;
+        do tmp[k++] = '0' + v % 10; while (v /= 10);
+        while (k) buf[pos++] = tmp[--k];
+    }
+
+    void write(char c) { reserve(1); buf[pos++] = c; }
+
+    void write(const char* s) { write(std::string_view(s)); }
+
+    void write(std::string_view s) {
+        for (size_t i = 0; i < s.size();) {
+            if (pos == BUF_SIZE) flush();
+            size_t k = std::min(s.size() - i, (size_t)(BUF_SIZE - pos));
+            std::memcpy(buf + pos, s.data() + i, k);
+            pos += k, i += k;
+        }
+    }
+
+    void write(double x) {
+        reserve(64);
+        pos += std::snprintf(buf + pos, 64, "%.15f", x);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); }
+    void write(T x) { write(x.value()); }  // ModInt
+
+    template <typename T, typename U>
+    void write(const std::pair<T, U>& p) { write(p.first), write(' '), write(p.second); }
+
+    template <typename T>
+    void write(const std::vector<T>& v) {
+        for (size_t i = 0; i < v.size(); i++) {
+            if (i) write(' ');
+            write(v[i]);
+        }
+    }
+
+    template <typename T>
+    FastOutput& operator<<(const T& x) { write(x); return *this; }
+};
+
+static FastInput in;
+static FastOutput out;
+
+
 // https://judge.yosupo.jp/problem/static_range_sum
 int main() {
     int N, Q;
-    std::cin >> N >> Q;
+    in >> N >> Q;
 
     std::vector<long long> A(N);
-    for (long long& a : A) std::cin >> a;
+    for (long long& a : A) in >> a;
 
-    auto op = [](long long a, long long b) { return a + b; };
-    SegmentTree<long long, decltype(op)> seg(N, op, 0);
+    SimdSegmentTree<long long, SumOp> seg(N);
 
     seg.build(A);
 
     while (Q--) {
         int l, r;
-        std::cin >> l >> r;
-        std::cout << seg.query(l, r) << std::endl;
+        in >> l >> r;
+        out << seg.query(l, r) << '\n';
     }
 
     return 0;
@@ -0,0 +1,362 @@
+#include <vector>
+#include <span>
+#include <limits>
+#include <algorithm>
+#include <concepts>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <type_traits>
+
+// Segment tree beats (Ji): range chmin / chmax / add, range sum / max / min. Each node keeps the
+// largest and second largest value with the count of the largest (and the same for the minimum),
+// so a chmin with max2 < x < max1 is a tag on the node; only nodes where x <= max2 are descended
+// into. Amortized O(log^2 n) per update with adds mixed in (O(log n) for chmin / chmax alone).
+template <std::signed_integral T = long long>
+class SegmentTreeBeats {
+private:
+    static constexpr T INF = std::numeric_limits<T>::max(), NINF = std::numeric_limits<T>::lowest();
+
+    struct Node {
+        T max1, max2, min1, min2, sum, add;
+        int maxc, minc;
+    };
+
+    int n;
+    std::vector<Node> nodes;  // node k covers [l, r), children split at (l + r) / 2
+
+    void update_node(int k) {
+        Node &p = nodes[k], &a = nodes[k << 1], &b = nodes[(k << 1) | 1];
+        p.sum = a.sum + b.sum;
+        if (a.max1 == b.max1) {
+            p.max1 = a.max1, p.maxc = a.maxc + b.maxc, p.max2 = std::max(a.max2, b.max2);
+        } else if (a.max1 > b.max1) {
+            p.max1 = a.max1, p.maxc = a.maxc, p.max2 = std::max(a.max2, b.max1);
+        } else {
+            p.max1 = b.max1, p.maxc = b.maxc, p.max2 = std::max(a.max1, b.max2);
+        }
+        if (a.min1 == b.min1) {
+            p.min1 = a.min1, p.minc = a.minc + b.minc, p.min2 = std::min(a.min2, b.min2);
+        } else if (a.min1 < b.min1) {
+            p.min1 = a.min1, p.minc = a.minc, p.min2 = std::min(a.min2, b.min1);
+        } else {
+            p.min1 = b.min1, p.minc = b.minc, p.min2 = std::min(a.min1, b.min2);
+        }
+    }
+
+    void apply_add(int k, T x, int len) {
+        Node& p = nodes[k];
+        p.max1 += x, p.min1 += x;
+        if (p.max2 != NINF) p.max2 += x;
+        if (p.min2 != INF) p.min2 += x;
+        p.sum += x * len;
+        p.add += x;
+    }
+
+    void apply_chmin(int k, T x) {  // requires max2 < x
+        Node& p = nodes[k];
+        if (x >= p.max1) return;
+        p.sum += (x - p.max1) * p.maxc;
+        if (p.min1 == p.max1) p.min1 = x;
+        else if (p.min2 == p.max1) p.min2 = x;
+        p.max1 = x;
+    }
+
+    void apply_chmax(int k, T x) {  // requires min2 > x
+        Node& p = nodes[k];
+        if (x <= p.min1) return;
+        p.sum += (x - p.min1) * p.minc;
+        if (p.max1 == p.min1) p.max1 = x;
+        else if (p.max2 == p.min1) p.max2 = x;
+        p.min1 = x;
+    }
+
+    void push(int k, int l, int r) {
+        int m = (l + r) >> 1;
+        if (nodes[k].add) {
+            apply_add(k << 1, nodes[k].add, m - l);
+            apply_add((k << 1) | 1, nodes[k].add, r - m);
+            nodes[k].add = 0;
+        }
+        for (int c = k << 1; c <= ((k << 1) | 1); c++) {
+            apply_chmin(c, nodes[k].max1);
+            apply_chmax(c, nodes[k].min1);
+        }
+    }
+
+    void build(int k, int l, int r, std::span<const T> v) {
+        if (r - l == 1) {
+            T x = l < (int)v.size() ? v[l] : 0;
+            nodes[k] = {x, NINF, x, INF, x, 0, 1, 1};
+            return;
+        }
+        int m = (l + r) >> 1;
+        build(k << 1, l, m, v);
+        build((k << 1) | 1, m, r, v);
+        nodes[k].add = 0;
+        update_node(k);
+    }
+
+    void chmin(int k, int l, int r, int a, int b, T x) {
+        if (b <= l || r <= a || x >= nodes[k].max1) return;
+        if (a <= l && r <= b && x > nodes[k].max2) {
+            apply_chmin(k, x);
+            return;
+        }
+        push(k, l, r);
+        int m = (l + r) >> 1;
+        chmin(k << 1, l, m, a, b, x);
+        chmin((k << 1) | 1, m, r, a, b, x);
+        update_node(k);
+    }
+
+    void chmax(int k, int l, int r, int a, int b, T x) {
+        if (b <= l || r <= a || x <= nodes[k].min1) return;
+        if (a <= l && r <= b && x < nodes[k].min2) {
+            apply_chmax(k, x);
+            return;
+        }
+        push(k, l, r);
+        int m = (l + r) >> 1;
+        chmax(k << 1, l, m, a, b, x);
+        chmax((k << 1) | 1, m, r, a, b, x);
+        update_node(k);
+    }
+
+    void add(int k, int l, int r, int a, int b, T x) {
+        if (b <= l || r <= a) return;
+        if (a <= l && r <= b) {
+            apply_add(k, x, r - l);
+            return;
+        }
+        push(k, l, r);
+        int m = (l + r) >> 1;
+        add(k << 1, l, m, a, b, x);
+        add((k << 1) | 1, m, r, a, b, x);
+        update_node(k);
+    }
+
+    // fold of [a, b) under p, every query below is one of these
+    template <typename P>
+    T fold(int k, int l, int r, int a, int b, T id, P p) {
+        if (b <= l || r <= a) return id;
+        if (a <= l && r <= b) return p(nodes[k], id);
+        push(k, l, r);
+        int m = (l + r) >> 1;
+        return fold((k << 1) | 1, m, r, a, b, fold(k << 1, l, m, a, b, id, p), p);
+    }
+
+public:
+    SegmentTreeBeats(int n_) : SegmentTreeBeats(std::vector<T>(n_)) {}
+
+    SegmentTreeBeats(std::span<const T> v) : n(v.size()), nodes(4 * std::max<int>(v.size(), 1)) {
+        if (n) build(1, 0, n, v);
+    }
+
+    void chmin(int a, int b, T x) {  // [a, b)
+        if (a < b) chmin(1, 0, n, a, b, x);
+    }
+
+    void chmax(int a, int b, T x) {  // [a, b)
+        if (a < b) chmax(1, 0, n, a, b, x);
+    }
+
+    void add(int a, int b, T x) {  // [a, b)
+        if (a < b) add(1, 0, n, a, b, x);
+    }
+
+    T sum(int a, int b) {  // [a, b)
+        if (a >= b) return 0;
+        return fold(1, 0, n, a, b, T(0), [](const Node& p, T acc) { return acc + p.sum; });
+    }
+
+    T max(int a, int b) {  // [a, b), lowest() if empty
+        if (a >= b) return NINF;
+        return fold(1, 0, n, a, b, NINF, [](const Node& p, T acc) { return std::max(acc, p.max1); });
+    }
+
+    T min(int a, int b) {  // [a, b), max() if empty
+        if (a >= b) return INF;
+        return fold(1, 0, n, a, b, INF, [](const Node& p, T acc) { return std::min(acc, p.min1); });
+    }
+};
+/*
+    // example
+    SegmentTreeBeats<long long> seg(A);
+    seg.chmin(l, r, x);     // a[i] = min(a[i], x) for i in [l, r)
+    seg.chmax(l, r, x);
+    seg.add(l, r, x);
+    seg.sum(l, r), seg.max(l, r), seg.min(l, r);
+*/
+
+struct FastInput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0, len = 0;
+
+    inline void refill() {
+        len -= pos;
+        std::memmove(buf, buf + pos, len);
+        pos = 0;
+        len += std::fread(buf + len, 1, BUF_SIZE - len, stdin);
+        if (len < BUF_SIZE) buf[len] = '\0';
+    }
+
+    inline char peek() {
+        if (pos == len) refill();
+        return pos < len ? buf[pos] : '\0';
+    }
+
+    inline char skip() {  // skips whitespace, returns the first non-space char ('\0' on EOF)
+        char c;
+        while ((c = peek()) && c <= ' ') pos++;
+        return c;
+    }
+
+public:
+    template <std::integral T>
+    void read(T& x) {
+        skip();
+        if (len - pos < 64) refill();
+        bool neg = false;
+        if constexpr (std::is_signed_v<T>) {
+            if (buf[pos] == '-') neg = true, pos++;
+        }
+        std::make_unsigned_t<T> v = 0;
+        while (pos < len && (unsigned)(buf[pos] - '0') < 10) v = v * 10 + (buf[pos++] - '0');
+        x = neg ? -(T)v : (T)v;
+    }
+
+    void read(char& c) { if ((c = skip())) pos++; }
+
+    void read(std::string& s) {
+        s.clear();
+        for (char c = skip(); c > ' '; c = peek()) s.push_back(c), pos++;
+    }
+
+    void read(double& x) {
+        std::string s;
+        read(s);
+        x = std::stod(s);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); } && std::constructible_from<T, long long>
+    void read(T& x) {  // ModInt
+        long long v;
+        read(v);
+        x = T(v);
+    }
+
+    template <typename T, typename U>
+    void read(std::pair<T, U>& p) { read(p.first), read(p.second); }
+
+    template <typename T>
+    void read(std::vector<T>& v) { for (auto& x : v) read(x); }
+
+    template <typename T>
+    FastInput& operator>>(T& x) { read(x); return *this; }
+};
+
+struct FastOutput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0;
+
+    inline void reserve(int k) {
+        if (pos + k > BUF_SIZE) flush();
+    }
+
+public:
+    ~FastOutput() { flush(); }
+
+    void flush() {
+        std::fwrite(buf, 1, pos, stdout);
+        std::fflush(stdout);
+        pos = 0;
+    }
+
+    template <std::integral T>
+    void write(T x) {
+        reserve(40);
+        std::make_unsigned_t<T> v = x;
+        if constexpr (std::is_signed_v<T>) {
+            if (x < 0) buf[pos++] = '-', v = -v;
+        }
+        char tmp[40];
+        int k = 0;
+        do tmp[k++] = '0' + v % 10; while (v /= 10);
+        while (k) buf[pos++] = tmp[--k];
+    }
+
+    void write(char c) { reserve(1); buf[pos++] = c; }
+
+    void write(const char* s) { write(std::string_view(s)); }
+
+    void write(std::string_view s) {
+        for (size_t i = 0; i < s.size();) {
+            if (pos == BUF_SIZE) flush();
+            size_t k = std::min(s.size() - i, (size_t)(BUF_SIZE - pos));
+            std::memcpy(buf + pos, s.data() + i, k);
+            pos += k, i += k;
+        }
+    }
+
+    void write(double x) {
+        reserve(64);
+        pos += std::snprintf(buf + pos, 64, "%.15f", x);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); }
+    void write(T x) { write(x.value()); }  // ModInt
+
+    template <typename T, typename U>
+    void write(const std::pair<T, U>& p) { write(p.first), write(' '), write(p.second); }
+
+    template <typename T>
+    void write(const std::vector<T>& v) {
+        for (size_t i = 0; i < v.size(); i++) {
+            if (i) write(' ');
+            write(v[i]);
+        }
+    }
+
+    template <typename T>
+    FastOutput& operator<<(const T& x) { write(x); return *this; }
+};
+
+static FastInput in;
+static FastOutput out;
+
+
+// https://judge.yosupo.jp/problem/range_chmin_chmax_add_range_sum
+int main() {
+    int N, Q;
+    in >> N >> Q;
+
+    std::vector<long long> A(N);
+    in >> A;
+
+    SegmentTreeBeats<long long> seg(A);
+
+    while (Q--) {
+        int t, l, r;
+        in >> t >> l >> r;
+        if (t == 3) {
+            out << seg.sum(l, r) << '\n';
+            continue;
+        }
+        long long b;
+        in >> b;
+        if (t == 0) seg.chmin(l, r, b);
+        else if (t == 1) seg.chmax(l, r, b);
+        else seg.add(l, r, b);
+    }
+
+    return 0;
+}
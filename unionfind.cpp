@@ -1,22 +1,44 @@
-#include <iostream>
 #include <vector>
 #include <unordered_map>
 #include <utility>
+#include <span>
+#include <atomic>
+#include <thread>
+#include <random>
+#include <numeric>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <concepts>
+#include <type_traits>
 
-struct UnionFind {
+// bookkeeping policies for UnionFind, inherited as its base: the default keeps only the par array,
+// EdgeLog also records every merge for make_groups / group_edges / edge_cnt. Without EdgeLog,
+// edges and group_edges do not exist, so reading the log is a compile error.
+struct NoEdgeLog {
+    static constexpr bool log_edges = false;
+};
+struct EdgeLog {
+    static constexpr bool log_edges = true;
+    std::unordered_map<int, std::vector<std::pair<int, int>>> group_edges;
+    std::vector<std::pair<int, int>> edges;
+};
+
+template <typename Policy = NoEdgeLog>
+struct UnionFind : Policy {
 private:
-    std::vector<int> par;
+    std::vector<int> par;  // par[x] < 0: x is a root and -par[x] its group size
 
 public:
     std::unordered_map<int, std::vector<int>> groups;
-    std::unordered_map<int, std::vector<std::pair<int, int>>> group_edges;
-    std::vector<std::pair<int, int>> edges;
     bool has_cycle;
 
     UnionFind(const int n_) : par(n_, -1), has_cycle(false) {}
 
     bool merge(const int x, const int y) {
-        edges.emplace_back(x, y);
+        if constexpr (Policy::log_edges) this->edges.emplace_back(x, y);
         int root_x = root(x);
         int root_y = root(y);
         if (root_x == root_y) {
@@ -33,9 +55,13 @@ public:
         return merge(p.first, p.second);
     }
 
-    int root(int x) {
-        if (par[x] < 0) return x;
-        return par[x] = root(par[x]);
+    int root(int x) {  // iterative path halving: every other node on the path skips to its grandparent
+        while (par[x] >= 0) {
+            const int p = par[x];
+            if (par[p] < 0) return p;
+            x = par[x] = par[p];
+        }
+        return x;
     }
 
     bool issame(const int x, const int y) {
@@ -46,37 +72,265 @@ public:
         return -par[root(x)];
     }
 
-    int edge_cnt(const int x) {
-        const auto it = group_edges.find(root(x));
-        return it != group_edges.end() ? it->second.size() : 0;
+    int edge_cnt(const int x) requires Policy::log_edges {
+        const auto it = this->group_edges.find(root(x));
+        return it != this->group_edges.end() ? it->second.size() : 0;
     }
 
     void make_groups() {
         for (int i = 0; i < static_cast<int>(par.size()); i++) {
             groups[root(i)].push_back(i);
         }
-        for (const auto& p : edges) {
-            group_edges[root(p.first)].push_back(p);
+        if constexpr (Policy::log_edges) {
+            for (const auto& p : this->edges) {
+                this->group_edges[root(p.first)].push_back(p);
+            }
+        }
+    }
+};
+
+
+// Union-find for many threads at once, without locks (Jayanti-Tarjan style). par[x] == x marks a
+// root. Roots are linked by one CAS, always below the root of higher priority, where the
+// priorities are a random permutation of [0, n) shuffled per instance: a strict total order, so no
+// cycle can form, and a random one independent of the edges, which gives the expected O(log n)
+// depth of Jayanti-Tarjan without storing sizes (one word per element instead). find splits
+// paths (each visited node CASes its parent to its grandparent; a failed CAS only means someone
+// else shortened it). merge is lock-free: a link fails only when another merge changed that root.
+// Sequentially consistent atomics throughout (free on x86 for loads and CAS), so merge / issame
+// are linearizable.
+struct ConcurrentUnionFind {
+private:
+    std::vector<std::atomic<int>> par;
+    std::vector<int> prio;  // read-only after construction
+
+    template <typename G>
+    static void run_parallel(unsigned threads, G g) {  // g(t) for t = 0 .. threads - 1, t = 0 on the calling thread
+        std::vector<std::thread> pool;
+        for (unsigned t = 1; t < threads; t++) pool.emplace_back(g, t);
+        g(0);
+        for (auto& th : pool) th.join();
+    }
+
+public:
+    ConcurrentUnionFind(const int n_) : par(n_), prio(n_) {
+        for (int i = 0; i < n_; i++) par[i].store(i, std::memory_order_relaxed);
+        std::iota(prio.begin(), prio.end(), 0);
+        std::random_device rd;
+        std::seed_seq seed{rd(), rd(), rd(), rd(), rd(), rd(), rd(), rd()};
+        std::shuffle(prio.begin(), prio.end(), std::mt19937_64(seed));
+    }
+
+    int root(int x) {
+        while (true) {
+            int p = par[x].load();
+            if (p == x) return x;
+            int gp = par[p].load();
+            if (p != gp) par[x].compare_exchange_weak(p, gp);
+            x = p;
+        }
+    }
+
+    bool merge(int x, int y) {
+        while (true) {
+            x = root(x), y = root(y);
+            if (x == y) return false;
+            if (prio[x] > prio[y]) std::swap(x, y);
+            int expected = x;
+            if (par[x].compare_exchange_strong(expected, y)) return true;
+        }
+    }
+
+    bool issame(int x, int y) {
+        while (true) {
+            x = root(x), y = root(y);
+            if (x == y) return true;
+            if (par[x].load() == x) return false;  // x still a root, so both were roots when y was found
+        }
+    }
+
+    // root of every vertex, after merging the edges on `threads` threads (contiguous chunks of the list)
+    static std::vector<int> connected_components(int n, std::span<const std::pair<int, int>> edges, unsigned threads) {
+        ConcurrentUnionFind uf(n);
+        const long long m = edges.size();
+        threads = std::max(1u, std::min<unsigned>(threads, m / 4096 + 1));
+        run_parallel(threads, [&](unsigned t) {
+            for (long long i = m * t / threads; i < m * (t + 1) / threads; i++) uf.merge(edges[i].first, edges[i].second);
+        });
+        std::vector<int> label(n);
+        run_parallel(threads, [&](unsigned t) {
+            for (int v = (long long)n * t / threads; v < (long long)n * (t + 1) / threads; v++) label[v] = uf.root(v);
+        });
+        return label;
+    }
+};
+/*
+    // example
+    UnionFind uf(n);                    // single thread: par array only
+    UnionFind<EdgeLog> uf(n);           // + edges / make_groups / group_edges / edge_cnt
+
+    ConcurrentUnionFind cuf(n);         // merge / issame / root from any number of threads
+    std::vector<int> label = ConcurrentUnionFind::connected_components(n, edges, std::thread::hardware_concurrency());
+*/
+
+struct FastInput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0, len = 0;
+
+    inline void refill() {
+        len -= pos;
+        std::memmove(buf, buf + pos, len);
+        pos = 0;
+        len += std::fread(buf + len, 1, BUF_SIZE - len, stdin);
+        if (len < BUF_SIZE) buf[len] = '\0';
+    }
+
+    inline char peek() {
+        if (pos == len) refill();
+        return pos < len ? buf[pos] : '\0';
+    }
+
+    inline char skip() {  // skips whitespace, returns the first non-space char ('\0' on EOF)
+        char c;
+        while ((c = peek()) && c <= ' ') pos++;
+        return c;
+    }
+
+public:
+    template <std::integral T>
+    void read(T& x) {
+        skip();
+        if (len - pos < 64) refill();
+        bool neg = false;
+        if constexpr (std::is_signed_v<T>) {
+            if (buf[pos] == '-') neg = true, pos++;
+        }
+        std::make_unsigned_t<T> v = 0;
+        while (pos < len && (unsigned)(buf[pos] - '0') < 10) v = v * 10 + (buf[pos++] - '0');
+        x = neg ? -(T)v : (T)v;
+    }
+
+    void read(char& c) { if ((c = skip())) pos++; }
+
+    void read(std::string& s) {
+        s.clear();
+        for (char c = skip(); c > ' '; c = peek()) s.push_back(c), pos++;
+    }
+
+    void read(double& x) {
+        std::string s;
+        read(s);
+        x = std::stod(s);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); } && std::constructible_from<T, long long>
+    void read(T& x) {  // ModInt
+        long long v;
+        read(v);
+        x = T(v);
+    }
+
+    template <typename T, typename U>
+    void read(std::pair<T, U>& p) { read(p.first), read(p.second); }
+
+    template <typename T>
+    void read(std::vector<T>& v) { for (auto& x : v) read(x); }
+
+    template <typename T>
+    FastInput& operator>>(T& x) { read(x); return *this; }
+};
+
+struct FastOutput {
+private:
+    static constexpr int BUF_SIZE = 1 << 17;
+    char buf[BUF_SIZE];
+    int pos = 0;
+
+    inline void reserve(int k) {
+        if (pos + k > BUF_SIZE) flush();
+    }
+
+public:
+    ~FastOutput() { flush(); }
+
+    void flush() {
+        std::fwrite(buf, 1, pos, stdout);
+        std::fflush(stdout);
+        pos = 0;
+    }
+
+    template <std::integral T>
+    void write(T x) {
+        reserve(40);
+        std::make_unsigned_t<T> v = x;
+        if constexpr (std::is_signed_v<T>) {
+            if (x < 0) buf[pos++] = '-', v = -v;
+        }
+        char tmp[40];
+        int k = 0;
+        do tmp[k++] = '0' + v % 10; while (v /= 10);
+        while (k) buf[pos++] = tmp[--k];
+    }
+
+    void write(char c) { reserve(1); buf[pos++] = c; }
+
+    void write(const char* s) { write(std::string_view(s)); }
+
+    void write(std::string_view s) {
+        for (size_t i = 0; i < s.size();) {
+            if (pos == BUF_SIZE) flush();
+            size_t k = std::min(s.size() - i, (size_t)(BUF_SIZE - pos));
+            std::memcpy(buf + pos, s.data() + i, k);
+            pos += k, i += k;
+        }
+    }
+
+    void write(double x) {
+        reserve(64);
+        pos += std::snprintf(buf + pos, 64, "%.15f", x);
+    }
+
+    template <typename T>
+    requires requires(T a) { a.value(); }
+    void write(T x) { write(x.value()); }  // ModInt
+
+    template <typename T, typename U>
+    void write(const std::pair<T, U>& p) { write(p.first), write(' '), write(p.second); }
+
+    template <typename T>
+    void write(const std::vector<T>& v) {
+        for (size_t i = 0; i < v.size(); i++) {
+            if (i) write(' ');
+            write(v[i]);
         }
     }
+
+    template <typename T>
+    FastOutput& operator<<(const T& x) { write(x); return *this; }
 };
 
+static FastInput in;
+static FastOutput out;
+
 
 // https://judge.yosupo.jp/problem/unionfind
 int main() {
     int N, Q;
-    std::cin >> N >> Q;
+    in >> N >> Q;
 
     UnionFind uf(N);
 
     while (Q--) {
         int t, u, v;
-        std::cin >> t >> u >> v;
+        in >> t >> u >> v;
 
         if (t == 0) {
             uf.merge(u, v);
         } else {
-            std::cout << (uf.issame(u, v) ? 1 : 0) << std::endl;
+            out << (uf.issame(u, v) ? 1 : 0) << '\n';
         }
     }
 